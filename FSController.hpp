@@ -109,19 +109,38 @@
 
 #include <algorithm>
 #include <array>
+#include <climits>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <condition_variable>
 #include <deque>
+#include <dirent.h>
+#include <exception>
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <random>
 #include <stack>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <system_error>
 #include <thread>
 #include <type_traits>
 #include <unistd.h>
@@ -129,8 +148,29 @@
 #include <unordered_set>
 #include <set>
 #include <functional>
+#include <future>
+#include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <linux/fiemap.h>
+#include <linux/fs.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#define FS_HAS_INOTIFY 1
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define FS_HAS_IO_URING 1
+#endif
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define FS_HAS_COROUTINES 1
+#endif
+
 /**
  * Namespace Pollution Guard, naming-collision prevention
  *
@@ -169,6 +209,31 @@ namespace FSControllerModule
 
 #define FS_MAX_FILE_NAME_LENGTH (std::uint16_t)200         /* the max length for individual absolute address */
 #define FS_MAX_COLLECTION_STACK_SIZE (std::uint32_t)100000 /* max value for instance aggregation size */
+#define FS_PARALLEL_READ_BATCH (std::size_t)64             /* files read per task by parallel scans */
+#define FS_WALKER_BUFFER_SIZE (std::size_t)65536           /* getdents64 buffer size per directory level */
+#define FS_BATCH_QUEUE_DEPTH (std::size_t)64               /* in-flight files for batched reads */
+#define FS_PROFILE_REGISTER_SHARDS (std::size_t)32         /* independently locked profile register shards, power of two */
+#define FS_REGISTER_BYTE_BUDGET (std::size_t)0             /* default profile register byte budget, 0 = bounded by entry count only */
+#define FS_STREAM_CHUNK_SIZE (std::size_t)1048576          /* default chunk size for streaming reads */
+#define FS_GROUP_COMMIT_WINDOW_US (std::size_t)2000        /* default group commit latency window, microseconds */
+#define FS_GROUP_COMMIT_MAX_BATCH (std::size_t)256         /* requests committing a batch before the window expires */
+#define FS_GROUP_COMMIT_SYNC_THREADS (std::size_t)8        /* threads syncing the files and directories of one batch in parallel, committer included */
+#define FS_WATCHER_POLL_TIMEOUT_MS (int)1000               /* longest a watcher thread sleeps before rechecking its stop request */
+#define FS_SCAN_INDEX_VERSION (std::uint32_t)1             /* on-disk scan index format version */
+#define FS_HISTOGRAM_SUB_BUCKET_BITS (std::size_t)3        /* latency histograms split every power of two range into 2^bits linear buckets */
+#define FS_HISTOGRAM_MAX_EXPONENT (std::size_t)40          /* latencies are clamped below 2^exponent nanoseconds */
+#define FS_PATH_TABLE_CHUNK_SIZE (std::size_t)1048576      /* largest arena chunk of FSPathTable */
+#define FS_ASYNC_WORKERS (std::size_t)0                    /* shared async executor workers, 0 uses hardware concurrency */
+#define FS_ASYNC_MAX_PENDING (std::size_t)1024             /* async operations queued or running before submitters block, co_await parks instead */
+#define FS_READ_PLAN_ORDER (std::uint8_t)1                 /* bulk read order, 0 submission order, 1 inode number, 2 FIEMAP physical offset */
+#define FS_READ_PLAN_MIN_BATCH (std::size_t)32             /* smaller batches(per directory for profiler scans) keep submission order */
+#define FS_READ_PLAN_LOOKAHEAD (std::size_t)0              /* planned files hinted WILLNEED ahead of the one being read, 0 disables hints(cold cache workloads only) */
+#define FS_READ_PLAN_WINDOW (std::size_t)2097152           /* bytes hinted per file, larger files are left to kernel readahead */
+
+/* define FS_DISABLE_INSTRUMENTATION before including to compile out operation timers and I/O counters */
+#if !defined(FS_DISABLE_INSTRUMENTATION)
+#define FS_HAS_INSTRUMENTATION 1
+#endif
 
 /* FKType is the foreign key type name to use for entity associations */
 #define __tm_file_aggregation template <typename _FKType, typename = std::enable_if<!std::is_array_v<_FKType> && !std::is_pointer_v<_FKType>>>
@@ -222,6 +287,33 @@ namespace FSControllerModule
 #define __0x_attr_FSC_fssh __attribute__((no_icf, always_inline, access(read_only, 1), optimize(ATTR_OPTIMIZE_LEVEL)))
 #define __0x_attr_FSC_recaggr __attribute__((hot, nothrow, access(read_only, 1), stack_protect, zero_call_used_regs("used"), optimize(ATTR_OPTIMIZE_LEVEL)))
 #define __0x_attr_FSC_dirbkv __attribute__((no_icf, warn_unused_result, cold, access(read_only, 1), access(read_only, 2), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_frv __attribute__((no_icf, warn_unused_result, hot, stack_protect, access(read_only, 1), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_mfv __attribute__((no_icf, warn_unused_result, hot, flatten, access(read_only, 1), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_frm __attribute__((no_icf, warn_unused_result, hot, stack_protect, access(read_only, 1), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_frmc __attribute__((no_icf, hot, stack_protect, access(read_only, 1), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_srbb __attribute__((no_icf, cold, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_grst __attribute__((no_icf, nothrow, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_gph __attribute__((no_icf, hot, warn_unused_result, access(read_only, 1), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_grsn __attribute__((no_icf, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_frc __attribute__((no_icf, hot, stack_protect, access(read_only, 1), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_fwa __attribute__((no_icf, hot, stack_protect, access(read_only, 1), access(read_only, 2), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_fwat __attribute__((no_icf, stack_protect, access(read_only, 1), access(read_only, 2), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_sgcw __attribute__((no_icf, cold, nothrow, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_cdbki __attribute__((no_icf, cold, warn_unused_result, stack_protect, access(read_only, 1), access(read_only, 2), optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_dbkv __attribute__((no_icf, cold, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_fhash __attribute__((hot, nothrow, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_dszdh __attribute__((no_icf, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_srcd __attribute__((no_icf, cold, nothrow, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_wdp __attribute__((no_icf, cold, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_ssi __attribute__((no_icf, cold, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_osi __attribute__((no_icf, cold, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_scnt __attribute__((no_icf, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_scntb __attribute__((hot, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_gisn __attribute__((no_icf, cold, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_rins __attribute__((no_icf, cold, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_asyncf __attribute__((no_icf, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_asyncc __attribute__((no_icf, optimize(ATTR_OPTIMIZE_LEVEL)))
+#define __0x_attr_FSC_asynca __attribute__((no_icf, warn_unused_result, optimize(ATTR_OPTIMIZE_LEVEL)))
 
 #else
 
@@ -265,6 +357,33 @@ namespace FSControllerModule
 #define __0x_attr_FSC_fssh [[]]
 #define __0x_attr_FSC_recaggr [[]]
 #define __0x_attr_FSC_dirbkv [[]]
+#define __0x_attr_FSC_frv [[nodiscard]]
+#define __0x_attr_FSC_mfv [[nodiscard]]
+#define __0x_attr_FSC_frm [[nodiscard]]
+#define __0x_attr_FSC_frmc [[]]
+#define __0x_attr_FSC_srbb [[]]
+#define __0x_attr_FSC_grst [[nodiscard]]
+#define __0x_attr_FSC_gph [[nodiscard]]
+#define __0x_attr_FSC_grsn [[nodiscard]]
+#define __0x_attr_FSC_frc [[]]
+#define __0x_attr_FSC_fwa [[]]
+#define __0x_attr_FSC_fwat [[]]
+#define __0x_attr_FSC_sgcw [[]]
+#define __0x_attr_FSC_cdbki [[nodiscard]]
+#define __0x_attr_FSC_dbkv [[nodiscard]]
+#define __0x_attr_FSC_fhash [[]]
+#define __0x_attr_FSC_dszdh [[nodiscard]]
+#define __0x_attr_FSC_srcd [[]]
+#define __0x_attr_FSC_wdp [[nodiscard]]
+#define __0x_attr_FSC_ssi [[]]
+#define __0x_attr_FSC_osi [[nodiscard]]
+#define __0x_attr_FSC_scnt [[]]
+#define __0x_attr_FSC_scntb [[]]
+#define __0x_attr_FSC_gisn [[nodiscard]]
+#define __0x_attr_FSC_rins [[]]
+#define __0x_attr_FSC_asyncf [[nodiscard]]
+#define __0x_attr_FSC_asyncc [[]]
+#define __0x_attr_FSC_asynca [[nodiscard]]
 
 #endif
 
@@ -310,6 +429,21 @@ namespace FSControllerModule
         READ_WRITE
     };
 
+    enum class eFileWriteMode : uint8_t
+    {
+        POSITIONAL = 0,
+        APPEND
+    };
+
+    enum class eMapAdvice : uint8_t
+    {
+        NORMAL = 0,
+        SEQUENTIAL,
+        RANDOM,
+        WILLNEED,
+        DONTNEED
+    };
+
     /*                      Structure                        *\
     \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
 
@@ -380,6 +514,20 @@ namespace FSControllerModule
             reg_stack_size--;
         };
 
+        inline void createProfile(struct stFileDescriptor &&_new_profile) noexcept
+        {
+            if (++reg_stack_size < FS_MAX_COLLECTION_STACK_SIZE - 1) [[likely]]
+            {
+                if (stack_register.find(_new_profile.file_name) == stack_register.end())
+                {
+                    _FKType profile_key(_new_profile.file_name);
+                    stack_register.emplace(std::move(profile_key), std::move(_new_profile));
+                }
+                return;
+            }
+            reg_stack_size--;
+        };
+
         inline void eraseProfile(const _FKType _fk)
         {
             if (gc_executed)
@@ -425,6 +573,12 @@ namespace FSControllerModule
 
 #pragma pack()
 
+    typedef struct alignas(void *)
+    {
+        std::size_t files{0};
+        std::size_t bytes{0};
+    } stExtensionTotals;
+
     typedef struct alignas(void *)
     {
         std::vector<String_t> registry{};
@@ -432,6 +586,15 @@ namespace FSControllerModule
         std::size_t registry_size{0};
         std::size_t max_size{0};
         std::size_t min_size{0};
+        std::size_t total_size{0};
+        double mean_size{0};
+        std::size_t p50_size{0};
+        std::size_t p90_size{0};
+        std::size_t p99_size{0};
+        std::array<std::size_t, 65> size_histogram{};                      /* files per log2 size class, [0] empty files, [k] sizes within [2^(k-1), 2^k) */
+        std::unordered_map<String_t, stExtensionTotals> extension_totals{}; /* keyed by extension including the dot, "" for none */
+        String_t newest_file_path{};
+        struct timespec newest_mtime{};
     } stDirectoryCollectionStat;
 
     typedef struct alignas(void *)
@@ -439,818 +602,6772 @@ namespace FSControllerModule
         String_t path{};
         String_t file{};
         bool has_found{false};
+        std::size_t pattern_index{0}; /* index of the matching pattern */
     } stDirectoryLookup;
 
-    /*             Template Specialization                   *\
-    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
-    template <typename _DirLookupType>
-    struct is_dir_lookup_return_type : std::disjunction<std::is_same<_DirLookupType, stDirectoryLookup>, std::is_same<_DirLookupType, std::vector<stDirectoryLookup>>>
+    typedef struct alignas(void *)
     {
-    };
-
-    template <typename _DirLookupType>
-    inline constexpr bool is_dir_lookup_return_type_v = is_dir_lookup_return_type<_DirLookupType>::value;
+        bool incremental{true};        /* skip files whose destination has the same size and mtime */
+        bool create_backup_dir{false}; /* create the destination directory when missing */
+        bool copy_empty_files{false};  /* also copy zero sized files */
+        std::size_t worker_count{0};   /* copy workers, 0 uses hardware concurrency */
+    } stBackupOptions;
 
-    /*                          Class                        *\
-    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+    typedef struct alignas(void *)
+    {
+        std::size_t files_copied{0};  /* files copied during this run */
+        std::size_t files_skipped{0}; /* files left untouched by incremental mode or skipped as empty */
+        std::size_t files_failed{0};  /* files that could not be copied, plus unreadable subdirectories */
+        std::size_t files_cloned{0};  /* copies served by a reflink */
+        std::size_t bytes_copied{0};  /* bytes of copied files */
+        bool success{false};
+    } stBackupReport;
+
+    enum class eBackupVerifyMode : uint8_t
+    {
+        SIZE = 0,     /* per file size */
+        METADATA,     /* per file size and modification time */
+        CONTENT_HASH  /* per file size and XXH64 content hash */
+    };
 
-    /**
-     * @class FSController
-     * foreign key type referes to the FK used to allocate/register file descriptor/profilers. will be used to get/set new entries.
-     */
-    template <typename _ForeignKeyType_ = String_t>
-    class FSController
+    typedef struct alignas(void *)
     {
-        using directoryScanResult_t = std::unordered_map<_ForeignKeyType_, struct stFileDescriptor>;
+        std::vector<String_t> mismatched{}; /* relative paths present on both sides that differ */
+        std::vector<String_t> missing{};    /* relative paths missing from the backup */
+        std::vector<String_t> extra{};      /* relative paths found only in the backup */
+        std::size_t files_compared{0};      /* files present on both sides */
+        std::size_t bytes_hashed{0};        /* bytes read by CONTENT_HASH, both sides */
+        bool verified{false};
+    } stBackupVerifyReport;
+
+    /* regular file indexed by backup verification */
+    typedef struct alignas(void *)
+    {
+        String_t path{};                /* full path */
+        std::size_t relative_offset{0}; /* start of the walk relative part within path */
+        std::size_t size{0};
+        struct timespec mtime{};
+        std::uint64_t hash{0};
+        bool hashed{false};             /* hash holds the file XXH64 digest */
+    } stVerifyEntry;
 
-    private:
+    typedef struct alignas(void *)
+    {
+        bool allocated_size{false};  /* sum allocated blocks(st_blocks * 512) instead of apparent sizes */
+        bool dedup_hardlinks{false}; /* count files with several hard links once, by (device, inode) */
+        bool same_filesystem{false}; /* do not descend into directories mounted from another device */
+        bool follow_symlinks{true};  /* count symlinks to regular files with their target size */
+        std::size_t worker_count{0}; /* 0 uses hardware concurrency */
+    } stDirectorySizeOptions;
 
-    bool sync_backup_exec_state;
-        struct stProfilerStackRegister _profile_stack_reg; /* file profile stack register */
+    typedef struct alignas(void *)
+    {
+        bool recursive{true};                /* search subdirectories too */
+        std::size_t max_matches_per_file{0}; /* matches reported per file before moving on, 0 = all */
+        std::size_t worker_count{0};         /* 0 uses hardware concurrency */
+    } stContentSearchOptions;
 
-        std::uint64_t _fs_instance_uid = GenerateRandomId(); /* fs instance unique id, for copy/move semantics, avoid copy */
+    /* content search match, views are only valid during the match callback */
+    typedef struct alignas(void *)
+    {
+        StringView_t path{};        /* matching file path */
+        std::size_t offset{0};      /* byte offset of the match within the file */
+        std::size_t line_number{0}; /* 1 based line number of the match */
+        StringView_t line{};        /* line holding the match, newline excluded */
+    } stContentMatch;
+
+    /* owning file descriptor, closed on scope exit */
+    struct stScopedDescriptor
+    {
+        int fd{-1};
 
-        bool _fs_new_instance = false; /* boolean flag indicating if instance is new or used,
-                                          double-free error prevention */
+        explicit stScopedDescriptor(const int _fd) noexcept : fd(_fd) {};
 
-        std::mutex _mtx_guard;
+        stScopedDescriptor(const stScopedDescriptor &o) = delete;
+        stScopedDescriptor &operator=(const stScopedDescriptor &o) = delete;
 
-    public:
-        /* FS Controller default Constructor */
-        explicit FSController() noexcept
+        ~stScopedDescriptor() noexcept
         {
-            if (!this->_fs_new_instance)
-                this->_fs_new_instance = true;
+            if (fd != -1)
+                close(fd);
         };
+    };
 
-        /* FS Controller Copy Constructor */
-        __0x_attr_FSC_cc FSController(const FSController &_o) noexcept : _profile_stack_reg(_o._profile_stack_reg), _fs_instance_uid(_o._fs_instance_uid), _fs_new_instance(_o._fs_instance_uid) {};
+    typedef struct alignas(void *)
+    {
+        std::size_t chunk_size{FS_STREAM_CHUNK_SIZE}; /* bytes per chunk, at least 4096 */
+        std::size_t start_offset{0};                  /* file offset to start streaming from */
+        bool read_ahead{true};                        /* read the next chunk while the current one is processed */
+        bool drop_behind{false};                      /* drop consumed ranges from the page cache */
+    } stChunkReadOptions;
 
-        /* FS Controller Copy Operator Overload */
-        __0x_attr_FSC_cc FSController &operator=(const FSController &_o) noexcept
-        {
-            return *this->__initFsController<const FSController &>(_o);
-        };
+    /**
+     *
+     * read-only mapped view over a file, owns the mapping and releases it on destruction.
+     * move-only, content is served directly from the page cache without any heap copy.
+     */
+    struct alignas(void *) stMappedFileView
+    {
+        fMap_t map_address{nullptr}; /* start of the mapped region, nullptr for empty files */
+        size_t map_size{0};          /* mapped region size in bytes */
+        String_t file_name{};        /* full path(absolute path) to file */
 
-        /* FS Controller Move Constructor */
-        __0x_attr_FSC_mc FSController(FSController &&_o) noexcept
-            : _profile_stack_reg(std::move(_o._profile_stack_reg)), _fs_instance_uid(std::move(_o._fs_instance_uid)), _fs_new_instance(std::move(_o._fs_instance_uid)) {};
+        stMappedFileView() noexcept = default;
 
-        /* FS Controller Move Operator Overload */
-        __0x_attr_FSC_mc FSController &operator=(FSController &&_o) noexcept
-        {
-            return *this->__initFsController<FSController &&>(std::move(_o));
-        };
+        stMappedFileView(const fMap_t _address, const size_t _size, const StringView_t _file_name) : map_address(_address), map_size(_size), file_name(_file_name) {};
 
-        /* FS Controller Comparision Operator Overload */
-        __0x_attr_FSC_co constexpr bool operator==(const FSController &_o) noexcept
+        stMappedFileView(const stMappedFileView &o) = delete;
+        stMappedFileView &operator=(const stMappedFileView &o) = delete;
+
+        stMappedFileView(stMappedFileView &&o) noexcept : map_address(std::exchange(o.map_address, nullptr)), map_size(std::exchange(o.map_size, 0)), file_name(std::move(o.file_name)) {};
+
+        stMappedFileView &operator=(stMappedFileView &&o) noexcept
         {
-            return this->_fs_instance_uid == _o._fs_instance_uid;
+            if (this != &o)
+            {
+                Release();
+                map_address = std::exchange(o.map_address, nullptr);
+                map_size = std::exchange(o.map_size, 0);
+                file_name = std::move(o.file_name);
+            }
+            return *this;
         };
-        __0x_attr_FSC_co constexpr bool operator!=(const FSController &_o) noexcept
+
+        /* mapped content as string view, valid as long as this view is alive */
+        inline const StringView_t View() const noexcept
         {
-            return !(this->_fs_instance_uid == _o._fs_instance_uid);
+            return map_address != nullptr ? StringView_t(map_address, map_size) : StringView_t();
         };
 
-        /**
-         *
-         * check if file_name exists or not.
-         * @param StringView_t absolute path to target file
-         * @returns bool true if file_name is found, false otherwise
-         *
-         */
-        __0x_attr_FSC_fe inline static const bool FileExists(const StringView_t &file_name) noexcept
+        inline const char *Data() const noexcept
         {
-            if (file_name.empty() || file_name.size() > FS_MAX_FILE_NAME_LENGTH || file_name.find(" ") != std::string::npos) [[unlikely]]
-                return false;
-            return std::filesystem::exists(file_name.data());
+            return map_address;
         };
 
-        /**
-         *
-         * check if every file within file_list exists or not, will return failure if even 1
-         * is missing.
-         * @param std::unordered_set<String_t> list with target files
-         * @returns bool true if every target within file_list is found, false otherwise
-         *
-         */
-        __0x_attr_FSC_fe inline static const bool FileExists(const std::unordered_set<String_t> &file_list) noexcept
+        inline const size_t Size() const noexcept
         {
-            if (file_list.empty() && file_list.size() > 500000) [[unlikely]]
-                return false;
-
-            for (const String_t &file_name : file_list)
-                if (!FileExists(file_name))
-                    return false;
-
-            return true;
+            return map_size;
         };
 
-        /**
-         *
-         * check if file_name is a text file
-         * @param StringView_t absolute path to target file
-         * @returns bool true if file_name is a text file, false otherwise
-         *
-         */
-        __0x_attr_FSC_itf inline static const bool IsTextFile(const StringView_t &file_name) noexcept
+        inline const bool Empty() const noexcept
         {
-            if (file_name.empty() || !FileExists(file_name))
-                return false;
-
-            return std::filesystem::is_regular_file(file_name.data());
+            return map_address == nullptr || map_size == 0;
         };
 
         /**
          *
-         * check if file_name is a executable
-         * @param StringView_t absolute path to target file
-         * @returns bool true if file_name is executable, false otherwise
-         *
+         * forward an access pattern hint for [_offset, _offset + _length) to the kernel, a zero
+         * length covers the mapping up to its end.
+         * @param eMapAdvice the access pattern hint
+         * @param size_t optional! offset within the mapping
+         * @param size_t optional! length of the advised range
+         * @returns bool true if the hint was accepted
          */
-        __0x_attr_FSC_iex inline static const bool IsExecutable(const StringView_t &file_name) noexcept
+        inline const bool Advise(const eMapAdvice _advice, size_t _offset = 0, size_t _length = 0) const noexcept
         {
-            if (IsTextFile(file_name.data()))
+            if (Empty() || _offset >= map_size)
+                return false;
+            static const size_t page_size(static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+            const size_t aligned_offset(_offset - (_offset % page_size));
+            const size_t range_end(_length == 0 || _offset + _length > map_size ? map_size : _offset + _length);
+            int advice(MADV_NORMAL);
+            switch (_advice)
             {
-                std::filesystem::perms f_perms = std::filesystem::status(file_name.data()).permissions();
-                if (((f_perms & std::filesystem::perms::owner_exec) != std::filesystem::perms::none) || ((f_perms & std::filesystem::perms::group_exec) != std::filesystem::perms::none) ||
-                    ((f_perms & std::filesystem::perms::others_exec) != std::filesystem::perms::none))
-                    return true;
+            case eMapAdvice::SEQUENTIAL:
+                advice = MADV_SEQUENTIAL;
+                break;
+            case eMapAdvice::RANDOM:
+                advice = MADV_RANDOM;
+                break;
+            case eMapAdvice::WILLNEED:
+                advice = MADV_WILLNEED;
+                break;
+            case eMapAdvice::DONTNEED:
+                advice = MADV_DONTNEED;
+                break;
+            default:
+                break;
             }
-            return false;
+            return madvise(map_address + aligned_offset, range_end - aligned_offset, advice) == 0;
         };
 
-        /**
-         *
-         * check if file_name is a symlink
-         * @param StringView_t absolute path to target symlink
-         * @returns bool true if file_name is symlink, false otherwise
-         *
-         */
-        __0x_attr_FSC_isl inline static const bool IsSymlink(const StringView_t &file_name) noexcept
+        /* unmap the region, view becomes empty */
+        inline void Release() noexcept
         {
-            return std::filesystem::is_symlink(file_name.data());
+            if (map_address != nullptr)
+                munmap(map_address, map_size);
+            map_address = nullptr;
+            map_size = 0;
         };
 
-        /**
-         *
-         * check if file_name is a directory
-         * @param StringView_t absolute path to target file
-         * @returns bool true if file_name is directory, false otherwise
-         *
-         */
-        __0x_attr_FSC_id inline static const bool IsDirectory(const StringView_t &file_name) noexcept
+        ~stMappedFileView() noexcept
         {
-            return std::filesystem::is_directory(file_name.data());
+            Release();
         };
+    };
 
-        /**
-         *
-         * Read _file_name content and return full profiler structure associated with
-         * _file_name.
-         * @param StringView_t the absolute file path to read
-         * @param bool a const boolean flag dictating if _file_name should be created on
-         * missing or not
-         * @returns stFileDescriptor a const read-only access to _file_name associated profile
-         * structure
-         *
-         */
-        __0x_attr_FSC_fr const struct stFileDescriptor FileRead(const StringView_t &_file_name, const bool _create_new = false)
-        {
+    /*                   Instrumentation                     *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-            this->__fileStreamStatusHandle(_file_name, _create_new);
+    enum class eInstrumentedOp : uint8_t
+    {
+        FILE_READ = 0,
+        FILE_READ_VIEW,
+        FILE_READ_MANY,
+        FILE_READ_CHUNKED,
+        FILE_WRITE,
+        FILE_WRITE_GATHER,
+        FILE_WRITE_ATOMIC,
+        DIRECTORY_PROFILER,
+        DIRECTORY_SIZE,
+        DIRECTORY_BACKUP,
+        DIRECTORY_BACKUP_VERIFY,
+        CONTENT_SEARCH,
+        COUNT
+    };
 
-            struct stFileDescriptor new_profiler(this->__createEmptyProfilerStructure(_file_name));
+    enum class eIoCounter : uint8_t
+    {
+        BYTES_READ = 0,
+        BYTES_WRITTEN,
+        MMAP_CALLS,
+        ENTRIES_WALKED,
+        DIRECTORIES_WALKED,
+        REGISTER_HITS,
+        REGISTER_MISSES,
+        COUNT
+    };
 
-            int fileDescriptor(this->__openFileDescriptor(_file_name, eFileDescriptorMode::READ));
+    typedef struct alignas(void *)
+    {
+        std::uint64_t calls{0};
+        std::uint64_t total_ns{0};
+        std::uint64_t mean_ns{0};
+        std::uint64_t p50_ns{0};
+        std::uint64_t p90_ns{0};
+        std::uint64_t p99_ns{0};
+        std::uint64_t p999_ns{0};
+        std::uint64_t max_ns{0}; /* percentiles and max are bucket upper bounds, within 2^-FS_HISTOGRAM_SUB_BUCKET_BITS */
+    } stOperationStats;
 
-            struct stat file_stat_description(this->__createFileStat(fileDescriptor));
+    typedef struct alignas(void *)
+    {
+        std::array<stOperationStats, static_cast<std::size_t>(eInstrumentedOp::COUNT)> operations{};
+        std::array<std::uint64_t, static_cast<std::size_t>(eIoCounter::COUNT)> counters{};
+        bool enabled{false}; /* false when built with FS_DISABLE_INSTRUMENTATION */
 
-            if (file_stat_description.st_size > 0)
-            {
-                new_profiler.file_size = file_stat_description.st_size;
+        inline const stOperationStats &operator[](const eInstrumentedOp _operation) const noexcept { return operations[static_cast<std::size_t>(_operation)]; };
+        inline const std::uint64_t operator[](const eIoCounter _counter) const noexcept { return counters[static_cast<std::size_t>(_counter)]; };
+    } stInstrumentationSnapshot;
 
-                fMap_t mapped_data_pointer(this->__createPointerMap(fileDescriptor, file_stat_description.st_size, true, 0));
+    /* bits needed to represent _value, 0 for 0, std::bit_width is C++20 only */
+    constexpr std::size_t BitWidth64(const std::uint64_t _value) noexcept
+    {
+        return _value == 0 ? 0 : static_cast<std::size_t>(64 - __builtin_clzll(_value));
+    };
 
-                this->__verifyMemMapState(mapped_data_pointer);
+    inline const char *InstrumentedOpName(const eInstrumentedOp _operation) noexcept
+    {
+        constexpr const char *operation_names[]{"FileRead", "FileReadView", "FileReadMany", "FileReadChunked", "FileWrite", "FileWriteGather", "FileWriteAtomic",
+                                                "DirectoryProfiler", "DirectorySize", "DirectoryBackup", "DirectoryBackupVerify", "ContentSearch"};
+        static_assert(std::size(operation_names) == static_cast<std::size_t>(eInstrumentedOp::COUNT));
+        return static_cast<std::size_t>(_operation) < std::size(operation_names) ? operation_names[static_cast<std::size_t>(_operation)] : "unknown";
+    };
 
-                this->__allocMappedBytes(new_profiler.file_content, &mapped_data_pointer, file_stat_description.st_size);
+    inline const char *IoCounterName(const eIoCounter _counter) noexcept
+    {
+        constexpr const char *counter_names[]{"bytes_read", "bytes_written", "mmap_calls", "entries_walked", "directories_walked", "register_hits", "register_misses"};
+        static_assert(std::size(counter_names) == static_cast<std::size_t>(eIoCounter::COUNT));
+        return static_cast<std::size_t>(_counter) < std::size(counter_names) ? counter_names[static_cast<std::size_t>(_counter)] : "unknown";
+    };
 
-                this->__descriptorMapClose(fileDescriptor, &mapped_data_pointer, file_stat_description.st_size);
-            }
-            return new_profiler;
-        };
+#if defined(FS_HAS_INSTRUMENTATION)
+    /**
+     * @class FSInstrumentation
+     * process-wide operation timers and I/O counters. every thread records into its own block
+     * (log-linear latency histogram per operation plus plain counters) with relaxed single-writer
+     * updates, no locks or shared cache lines on the hot path. Snapshot() merges the live blocks,
+     * blocks of exited threads are folded into a retired total, Reset() moves the baseline
+     * instead of touching blocks owned by other threads.
+     */
+    class FSInstrumentation
+    {
+    public:
+        static constexpr std::size_t sub_bucket_count{std::size_t(1) << FS_HISTOGRAM_SUB_BUCKET_BITS};
+        static constexpr std::size_t bucket_count{sub_bucket_count + (FS_HISTOGRAM_MAX_EXPONENT - FS_HISTOGRAM_SUB_BUCKET_BITS) * sub_bucket_count};
 
-        /**
-         *
-         * put _buffer into file _fle_name, create new _file_name if _create_new is true and
-         * _file_name is not found.
-         * @param StringView_t read only argument value representing absolute path to
-         * _file_name
-         * @param StringView_t read only argument value holding data to be written into
-         * _file_name
-         * @param bool const boolean flag dictating if _file_name should be create if not
-         * found
-         * @returns void
-         *
-         */
-        __0x_attr_FSC_fw inline void FileWrite(const StringView_t &_file_name, const StringView_t &_buffer, const bool _create_new = false)
+        /* process-wide instrumentation shared by every FSController instance */
+        static FSInstrumentation &Shared(void)
         {
+            static FSInstrumentation shared_instrumentation;
+            return shared_instrumentation;
+        };
 
-            this->__fileStreamStatusHandle(_file_name, _create_new, _buffer);
-
-            int fileDescriptor(this->__openFileDescriptor(std::move(_file_name), eFileDescriptorMode::WRITE));
+        FSInstrumentation(const FSInstrumentation &o) = delete;
+        FSInstrumentation &operator=(const FSInstrumentation &o) = delete;
 
-            const off_t file_size(_buffer.length());
+        /* time the enclosing scope as one call of _operation */
+        class stScopedTimer
+        {
+        public:
+            explicit stScopedTimer(const eInstrumentedOp _operation) noexcept : _operation(_operation), _begin(std::chrono::steady_clock::now()) {};
+            stScopedTimer(const stScopedTimer &o) = delete;
+            stScopedTimer &operator=(const stScopedTimer &o) = delete;
+            ~stScopedTimer() noexcept
+            {
+                Record(_operation, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _begin).count()));
+            };
 
-            this->__descriptorResize(fileDescriptor, file_size);
+        private:
+            const eInstrumentedOp _operation;
+            const std::chrono::steady_clock::time_point _begin;
+        };
 
-            fMap_t mapped_data(this->__createPointerMap(fileDescriptor, file_size, false, 0));
+        static inline void Record(const eInstrumentedOp _operation, const std::uint64_t _elapsed_ns) noexcept
+        {
+            stThreadBlock &thread_block(__localBlock());
+            const std::size_t op_index(static_cast<std::size_t>(_operation));
+            __bump(thread_block.histograms[op_index][BucketIndex(_elapsed_ns)], 1);
+            __bump(thread_block.total_ns[op_index], _elapsed_ns);
+        };
 
-            this->__verifyMemMapState(mapped_data);
+        static inline void Count(const eIoCounter _counter, const std::uint64_t _amount) noexcept
+        {
+            __bump(__localBlock().counters[static_cast<std::size_t>(_counter)], _amount);
+        };
 
-            this->__copyMappedMemoryBytes(mapped_data, _buffer);
+        static constexpr std::size_t BucketIndex(std::uint64_t _value) noexcept
+        {
+            _value = std::min<std::uint64_t>(_value, (std::uint64_t(1) << FS_HISTOGRAM_MAX_EXPONENT) - 1);
+            if (_value < sub_bucket_count)
+                return static_cast<std::size_t>(_value);
+            const std::size_t exponent(BitWidth64(_value) - 1);
+            const std::size_t sub_bucket(static_cast<std::size_t>(_value >> (exponent - FS_HISTOGRAM_SUB_BUCKET_BITS)) & (sub_bucket_count - 1));
+            return (exponent - FS_HISTOGRAM_SUB_BUCKET_BITS + 1) * sub_bucket_count + sub_bucket;
+        };
 
-            this->__descriptorMapClose(fileDescriptor, &mapped_data, file_size);
+        /* highest value falling into _bucket */
+        static constexpr std::uint64_t BucketUpperBound(const std::size_t _bucket) noexcept
+        {
+            if (_bucket < sub_bucket_count)
+                return _bucket;
+            const std::size_t exponent(_bucket / sub_bucket_count - 1 + FS_HISTOGRAM_SUB_BUCKET_BITS);
+            const std::uint64_t lower_bound((std::uint64_t(1) << exponent) | (std::uint64_t(_bucket % sub_bucket_count) << (exponent - FS_HISTOGRAM_SUB_BUCKET_BITS)));
+            return lower_bound + (std::uint64_t(1) << (exponent - FS_HISTOGRAM_SUB_BUCKET_BITS)) - 1;
         };
 
-        /**
-         *
-         * Register new Profile, propagate _new_profile into local register.
-         * @param struct stFileDescriptor new profile to allocate
+        inline const stInstrumentationSnapshot Snapshot(void)
+        {
+            std::unique_ptr<stTotals> current_totals(std::make_unique<stTotals>());
+            {
+                std::lock_guard<std::mutex> _lock(this->_blocks_guard);
+                this->__collectLocked(*current_totals);
+            }
+
+            stInstrumentationSnapshot instrumentation_snapshot{.enabled = true};
+            for (std::size_t c = 0; c < instrumentation_snapshot.counters.size(); ++c)
+                instrumentation_snapshot.counters[c] = current_totals->counters[c];
+            for (std::size_t op = 0; op < instrumentation_snapshot.operations.size(); ++op)
+            {
+                const std::array<std::uint64_t, bucket_count> &histogram(current_totals->histograms[op]);
+                stOperationStats &operation_stats(instrumentation_snapshot.operations[op]);
+                for (const std::uint64_t bucket_calls : histogram)
+                    operation_stats.calls += bucket_calls;
+                if (operation_stats.calls == 0)
+                    continue;
+                operation_stats.total_ns = current_totals->total_ns[op];
+                operation_stats.mean_ns = operation_stats.total_ns / operation_stats.calls;
+                operation_stats.p50_ns = __percentile(histogram, operation_stats.calls, 0.50);
+                operation_stats.p90_ns = __percentile(histogram, operation_stats.calls, 0.90);
+                operation_stats.p99_ns = __percentile(histogram, operation_stats.calls, 0.99);
+                operation_stats.p999_ns = __percentile(histogram, operation_stats.calls, 0.999);
+                operation_stats.max_ns = __percentile(histogram, operation_stats.calls, 1.0);
+            }
+            return instrumentation_snapshot;
+        };
+
+        /* discard everything recorded so far, subsequent snapshots start from zero */
+        inline void Reset(void)
+        {
+            std::unique_ptr<stTotals> current_totals(std::make_unique<stTotals>());
+            std::lock_guard<std::mutex> _lock(this->_blocks_guard);
+            this->_baseline = std::make_unique<stTotals>();
+            this->__collectLocked(*current_totals);
+            this->_baseline = std::move(current_totals);
+        };
+
+    private:
+        typedef struct alignas(64)
+        {
+            std::array<std::array<std::atomic<std::uint64_t>, bucket_count>, static_cast<std::size_t>(eInstrumentedOp::COUNT)> histograms{};
+            std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(eInstrumentedOp::COUNT)> total_ns{};
+            std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(eIoCounter::COUNT)> counters{};
+        } stThreadBlock;
+
+        struct stTotals
+        {
+            std::array<std::array<std::uint64_t, bucket_count>, static_cast<std::size_t>(eInstrumentedOp::COUNT)> histograms{};
+            std::array<std::uint64_t, static_cast<std::size_t>(eInstrumentedOp::COUNT)> total_ns{};
+            std::array<std::uint64_t, static_cast<std::size_t>(eIoCounter::COUNT)> counters{};
+
+            inline void Add(const stThreadBlock &_block) noexcept
+            {
+                for (std::size_t op = 0; op < histograms.size(); ++op)
+                {
+                    for (std::size_t b = 0; b < bucket_count; ++b)
+                        histograms[op][b] += _block.histograms[op][b].load(std::memory_order_relaxed);
+                    total_ns[op] += _block.total_ns[op].load(std::memory_order_relaxed);
+                }
+                for (std::size_t c = 0; c < counters.size(); ++c)
+                    counters[c] += _block.counters[c].load(std::memory_order_relaxed);
+            };
+        };
+
+        /* registers the calling thread's block on first use, folds it into the retired total on thread exit */
+        struct stThreadSlot
+        {
+            std::unique_ptr<stThreadBlock> block{std::make_unique<stThreadBlock>()};
+
+            stThreadSlot() { FSInstrumentation::Shared().__attach(block.get()); };
+            ~stThreadSlot() { FSInstrumentation::Shared().__retire(block.get()); };
+        };
+
+        std::mutex _blocks_guard;
+        std::vector<const stThreadBlock *> _live_blocks;
+        std::unique_ptr<stTotals> _retired{std::make_unique<stTotals>()};
+        std::unique_ptr<stTotals> _baseline{std::make_unique<stTotals>()};
+
+        FSInstrumentation() = default;
+
+        static inline stThreadBlock &__localBlock(void) noexcept
+        {
+            thread_local stThreadSlot thread_slot;
+            return *thread_slot.block;
+        };
+
+        /* only the owning thread writes a block, a plain load/store pair avoids a locked RMW */
+        static inline void __bump(std::atomic<std::uint64_t> &_cell, const std::uint64_t _amount) noexcept
+        {
+            _cell.store(_cell.load(std::memory_order_relaxed) + _amount, std::memory_order_relaxed);
+        };
+
+        inline void __attach(const stThreadBlock *_block)
+        {
+            std::lock_guard<std::mutex> _lock(this->_blocks_guard);
+            this->_live_blocks.push_back(_block);
+        };
+
+        inline void __retire(const stThreadBlock *_block) noexcept
+        {
+            std::lock_guard<std::mutex> _lock(this->_blocks_guard);
+            this->_retired->Add(*_block);
+            this->_live_blocks.erase(std::remove(this->_live_blocks.begin(), this->_live_blocks.end(), _block), this->_live_blocks.end());
+        };
+
+        /* retired + live - baseline, called with _blocks_guard held */
+        inline void __collectLocked(stTotals &_totals) const noexcept
+        {
+            _totals = *this->_retired;
+            for (const stThreadBlock *live_block : this->_live_blocks)
+                _totals.Add(*live_block);
+            for (std::size_t op = 0; op < _totals.histograms.size(); ++op)
+            {
+                for (std::size_t b = 0; b < bucket_count; ++b)
+                    _totals.histograms[op][b] -= std::min(_totals.histograms[op][b], this->_baseline->histograms[op][b]);
+                _totals.total_ns[op] -= std::min(_totals.total_ns[op], this->_baseline->total_ns[op]);
+            }
+            for (std::size_t c = 0; c < _totals.counters.size(); ++c)
+                _totals.counters[c] -= std::min(_totals.counters[c], this->_baseline->counters[c]);
+        };
+
+        static inline const std::uint64_t __percentile(const std::array<std::uint64_t, bucket_count> &_histogram, const std::uint64_t _calls, const double _rank) noexcept
+        {
+            const std::uint64_t target_rank(std::max<std::uint64_t>(1, static_cast<std::uint64_t>(_rank * static_cast<double>(_calls) + 0.999999)));
+            std::uint64_t seen_calls(0);
+            for (std::size_t b = 0; b < bucket_count; ++b)
+            {
+                seen_calls += _histogram[b];
+                if (seen_calls >= target_rank)
+                    return BucketUpperBound(b);
+            }
+            return BucketUpperBound(bucket_count - 1);
+        };
+    };
+
+#define FS_INSTRUMENT_SCOPE(_operation) const FSInstrumentation::stScopedTimer __fs_scoped_timer(_operation)
+#define FS_INSTRUMENT_COUNT(_counter, _amount) FSInstrumentation::Count(_counter, static_cast<std::uint64_t>(_amount))
+#else
+#define FS_INSTRUMENT_SCOPE(_operation) ((void)0)
+#define FS_INSTRUMENT_COUNT(_counter, _amount) ((void)0)
+#endif
+
+    /*                  Content Hashing                      *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     * @class FSContentHash
+     * streaming XXH64 hasher(non cryptographic), four independent 64 bit lanes over 32 byte
+     * stripes so the compiler can keep them in flight together, output is bit compatible with the
+     * reference xxHash XXH64 implementation.
+     */
+    class FSContentHash
+    {
+    public:
+        explicit FSContentHash(const std::uint64_t _seed = 0) noexcept { Reset(_seed); };
+
+        inline void Reset(const std::uint64_t _seed = 0) noexcept
+        {
+            _lanes[0] = _seed + _prime_1 + _prime_2;
+            _lanes[1] = _seed + _prime_2;
+            _lanes[2] = _seed;
+            _lanes[3] = _seed - _prime_1;
+            _seed_value = _seed;
+            _total_length = 0;
+            _buffered = 0;
+        };
+
+        inline void Update(const void *_data, std::size_t _length) noexcept
+        {
+            const unsigned char *input(static_cast<const unsigned char *>(_data));
+            _total_length += _length;
+            if (_buffered + _length < sizeof(_stripe))
+            {
+                if (_length != 0)
+                    std::memcpy(_stripe + _buffered, input, _length);
+                _buffered += _length;
+                return;
+            }
+            if (_buffered != 0)
+            {
+                const std::size_t fill(sizeof(_stripe) - _buffered);
+                std::memcpy(_stripe + _buffered, input, fill);
+                __consumeStripe(_stripe);
+                input += fill;
+                _length -= fill;
+                _buffered = 0;
+            }
+            for (; _length >= sizeof(_stripe); input += sizeof(_stripe), _length -= sizeof(_stripe))
+                __consumeStripe(input);
+            if (_length != 0)
+                std::memcpy(_stripe, input, _length);
+            _buffered = _length;
+        };
+
+        inline const std::uint64_t Digest(void) const noexcept
+        {
+            std::uint64_t hash;
+            if (_total_length >= sizeof(_stripe))
+            {
+                hash = __rotl64(_lanes[0], 1) + __rotl64(_lanes[1], 7) + __rotl64(_lanes[2], 12) + __rotl64(_lanes[3], 18);
+                for (const std::uint64_t lane : _lanes)
+                    hash = (hash ^ __round(0, lane)) * _prime_1 + _prime_4;
+            }
+            else
+            {
+                hash = _seed_value + _prime_5;
+            }
+            hash += _total_length;
+
+            const unsigned char *tail(_stripe);
+            std::size_t remaining(_buffered);
+            for (; remaining >= 8; tail += 8, remaining -= 8)
+                hash = __rotl64(hash ^ __round(0, __read64(tail)), 27) * _prime_1 + _prime_4;
+            if (remaining >= 4)
+            {
+                hash = __rotl64(hash ^ (static_cast<std::uint64_t>(__read32(tail)) * _prime_1), 23) * _prime_2 + _prime_3;
+                tail += 4;
+                remaining -= 4;
+            }
+            for (; remaining != 0; ++tail, --remaining)
+                hash = __rotl64(hash ^ (*tail * _prime_5), 11) * _prime_1;
+
+            hash ^= hash >> 33;
+            hash *= _prime_2;
+            hash ^= hash >> 29;
+            hash *= _prime_3;
+            hash ^= hash >> 32;
+            return hash;
+        };
+
+        /* one shot hash of _data */
+        static inline const std::uint64_t Hash(const void *_data, const std::size_t _length, const std::uint64_t _seed = 0) noexcept
+        {
+            FSContentHash hasher(_seed);
+            hasher.Update(_data, _length);
+            return hasher.Digest();
+        };
+
+    private:
+        static constexpr std::uint64_t _prime_1 = 0x9E3779B185EBCA87ULL;
+        static constexpr std::uint64_t _prime_2 = 0xC2B2AE3D27D4EB4FULL;
+        static constexpr std::uint64_t _prime_3 = 0x165667B19E3779F9ULL;
+        static constexpr std::uint64_t _prime_4 = 0x85EBCA77C2B2AE63ULL;
+        static constexpr std::uint64_t _prime_5 = 0x27D4EB2F165667C5ULL;
+
+        std::uint64_t _lanes[4];
+        std::uint64_t _seed_value{0};
+        std::uint64_t _total_length{0};
+        std::size_t _buffered{0};
+        unsigned char _stripe[32];
+
+        /* std::rotl is C++20 only */
+        static constexpr std::uint64_t __rotl64(const std::uint64_t _value, const int _shift) noexcept
+        {
+            return (_value << _shift) | (_value >> (64 - _shift));
+        };
+
+        static inline const std::uint64_t __round(std::uint64_t _accumulator, const std::uint64_t _input) noexcept
+        {
+            _accumulator += _input * _prime_2;
+            return __rotl64(_accumulator, 31) * _prime_1;
+        };
+
+        static inline const std::uint64_t __read64(const unsigned char *_ptr) noexcept
+        {
+            std::uint64_t value;
+            std::memcpy(&value, _ptr, sizeof(value));
+            if constexpr (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                value = __builtin_bswap64(value);
+            return value;
+        };
+
+        static inline const std::uint32_t __read32(const unsigned char *_ptr) noexcept
+        {
+            std::uint32_t value;
+            std::memcpy(&value, _ptr, sizeof(value));
+            if constexpr (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                value = __builtin_bswap32(value);
+            return value;
+        };
+
+        inline void __consumeStripe(const unsigned char *_ptr) noexcept
+        {
+            _lanes[0] = __round(_lanes[0], __read64(_ptr));
+            _lanes[1] = __round(_lanes[1], __read64(_ptr + 8));
+            _lanes[2] = __round(_lanes[2], __read64(_ptr + 16));
+            _lanes[3] = __round(_lanes[3], __read64(_ptr + 24));
+        };
+    };
+
+    /*                Sharded Profile Register               *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     *
+     * immutable registered profile, content buffer is shared so handing a profile out never copies
+     * the file bytes.
+     */
+    struct alignas(void *) stProfileRecord
+    {
+        String_t file_name{};                            /* full path(absolute path) to file */
+        size_t file_size{};                              /* file size in bytes */
+        std::shared_ptr<const String_t> file_content{};  /* shared, immutable file content */
+
+        /* content view, valid as long as the record(or its content buffer) is alive */
+        inline const StringView_t Content() const noexcept
+        {
+            return file_content ? StringView_t(*file_content) : StringView_t();
+        };
+
+        /* deep copy into a standalone descriptor */
+        inline const struct stFileDescriptor ToDescriptor() const
+        {
+            return stFileDescriptor{.file_content{file_content ? *file_content : String_t()}, .file_name{file_name}, .file_size{file_size}};
+        };
+    };
+
+    /* reference counted read-only handle to a registered profile */
+    using ProfileHandle_t = std::shared_ptr<const struct stProfileRecord>;
+
+    typedef struct alignas(void *)
+    {
+        std::size_t entries{0};        /* profiles currently resident */
+        std::size_t resident_bytes{0}; /* estimated bytes held by resident profiles */
+        std::size_t byte_budget{0};    /* configured byte budget, 0 when unbounded */
+        std::uint64_t hits{0};         /* lookups served from the register */
+        std::uint64_t misses{0};       /* lookups for absent profiles */
+        std::uint64_t insertions{0};   /* profiles admitted into the register */
+        std::uint64_t evictions{0};    /* profiles evicted to respect the budget or entry cap */
+        std::uint64_t rejections{0};   /* profiles refused because they exceed the whole budget */
+        std::size_t content_bytes{0};        /* file content bytes of resident profiles, as if stored per key */
+        std::size_t unique_content_bytes{0}; /* file content bytes actually stored */
+        std::uint64_t dedup_hits{0};         /* profiles that reused an existing content blob */
+        double dedup_ratio{1.0};             /* content_bytes / unique_content_bytes */
+    } stRegisterStats;
+
+    /**
+     * @class FSContentBlobStore
+     * content addressed store of immutable file contents, identical contents registered under
+     * different keys share a single reference counted blob. blobs are indexed by XXH64 and compared
+     * byte-wise on a hash hit, a blob leaves the store once its last reference is released. every
+     * Intern/Adopt counts one register entry on the blob until Unreference, only blobs with entries
+     * are accounted, handles kept past eviction do not count. must be owned by a std::shared_ptr.
+     */
+    class FSContentBlobStore : public std::enable_shared_from_this<FSContentBlobStore>
+    {
+    public:
+        using Blob_t = std::shared_ptr<const String_t>;
+
+        /**
+         *
+         * shared blob holding _content for one more register entry, an existing blob with identical
+         * bytes is returned instead of storing _content again.
+         * @param String_t the content, moved from when passed as rvalue and not already stored
+         * @param std::uint64_t FSContentHash of _content
+         * @param bool& set to true when an existing blob was reused
+         * @returns Blob_t the shared blob
+         */
+        template <typename _ContentRef>
+        inline Blob_t Intern(_ContentRef &&_content, const std::uint64_t _content_hash, bool &_reused)
+        {
+            stBlobShard &shard(this->_shards[_content_hash & (FS_PROFILE_REGISTER_SHARDS - 1)]);
+            std::vector<Blob_t> rejected_blobs; /* released after the shard lock, their deleter locks the shard */
+            std::lock_guard<std::mutex> _lock(shard.blob_guard);
+            const auto [candidate_begin, candidate_end] = shard.blobs.equal_range(_content_hash);
+            for (auto candidate = candidate_begin; candidate != candidate_end; ++candidate)
+            {
+                Blob_t existing_blob(candidate->second.ref.lock());
+                if (existing_blob && *existing_blob == _content)
+                {
+                    this->__referenceLocked(candidate->second);
+                    _reused = true;
+                    return existing_blob;
+                }
+                if (existing_blob)
+                    rejected_blobs.push_back(std::move(existing_blob));
+            }
+
+            Blob_t blob_payload(std::make_shared<const String_t>(std::forward<_ContentRef>(_content)));
+            const String_t *new_blob(blob_payload.get());
+            Blob_t blob_ref(new_blob, stBlobRelease{this->weak_from_this(), _content_hash, std::move(blob_payload)});
+            this->__referenceLocked(shard.blobs.emplace(_content_hash, stBlobSlot{new_blob, blob_ref})->second);
+            _reused = false;
+            return blob_ref;
+        };
+
+        /**
+         *
+         * index _blob, interned by another store, in this store for one more register entry without
+         * copying its bytes. the returned blob shares the bytes but not the other store's reference,
+         * each store accounts only the blobs its own entries reference.
+         * @param Blob_t& blob handed out by another store
+         * @param std::uint64_t FSContentHash of the blob content
+         * @returns Blob_t the blob indexed by this store
+         */
+        inline Blob_t Adopt(const Blob_t &_blob, const std::uint64_t _content_hash)
+        {
+            stBlobShard &shard(this->_shards[_content_hash & (FS_PROFILE_REGISTER_SHARDS - 1)]);
+            std::vector<Blob_t> rejected_blobs; /* released after the shard lock, their deleter locks the shard */
+            std::lock_guard<std::mutex> _lock(shard.blob_guard);
+            const auto [candidate_begin, candidate_end] = shard.blobs.equal_range(_content_hash);
+            for (auto candidate = candidate_begin; candidate != candidate_end; ++candidate)
+            {
+                Blob_t existing_blob(candidate->second.ref.lock());
+                if (existing_blob && (existing_blob.get() == _blob.get() || *existing_blob == *_blob))
+                {
+                    this->__referenceLocked(candidate->second);
+                    return existing_blob;
+                }
+                if (existing_blob)
+                    rejected_blobs.push_back(std::move(existing_blob));
+            }
+
+            const stBlobRelease *origin_release(std::get_deleter<stBlobRelease>(_blob));
+            Blob_t blob_ref(_blob.get(), stBlobRelease{this->weak_from_this(), _content_hash, origin_release != nullptr ? origin_release->payload : _blob});
+            this->__referenceLocked(shard.blobs.emplace(_content_hash, stBlobSlot{_blob.get(), blob_ref})->second);
+            return blob_ref;
+        };
+
+        /**
+         *
+         * a register entry holding _blob was erased, the blob stops being accounted with its last
+         * entry even if handles keep it alive.
+         * @param String_t* the blob content, as returned by Intern/Adopt
+         * @param std::uint64_t FSContentHash of the blob content
+         * @returns void
+         */
+        inline void Unreference(const String_t *_blob, const std::uint64_t _content_hash) noexcept
+        {
+            stBlobShard &shard(this->_shards[_content_hash & (FS_PROFILE_REGISTER_SHARDS - 1)]);
+            std::lock_guard<std::mutex> _lock(shard.blob_guard);
+            const auto [candidate_begin, candidate_end] = shard.blobs.equal_range(_content_hash);
+            for (auto candidate = candidate_begin; candidate != candidate_end; ++candidate)
+            {
+                if (candidate->second.blob != _blob || candidate->second.entries == 0)
+                    continue;
+                if (--candidate->second.entries == 0)
+                {
+                    this->_unique_bytes.fetch_sub(_blob->size(), std::memory_order_relaxed);
+                    this->_unique_blobs.fetch_sub(1, std::memory_order_relaxed);
+                }
+                return;
+            }
+        };
+
+        /* bytes of blobs referenced by register entries */
+        inline const std::size_t UniqueBytes(void) const noexcept
+        {
+            return this->_unique_bytes.load(std::memory_order_relaxed);
+        };
+
+        /* number of blobs referenced by register entries */
+        inline const std::size_t UniqueBlobs(void) const noexcept
+        {
+            return this->_unique_blobs.load(std::memory_order_relaxed);
+        };
+
+    private:
+        struct stBlobSlot
+        {
+            const String_t *blob;             /* identity of the blob, valid while ref is alive */
+            std::weak_ptr<const String_t> ref; /* non owning reference handed out by Intern */
+            std::size_t entries{0};            /* register entries referencing the blob */
+        };
+
+        struct alignas(64) stBlobShard
+        {
+            std::mutex blob_guard;
+            std::unordered_multimap<std::uint64_t, stBlobSlot> blobs; /* content hash -> blob */
+        };
+
+        /* blob deleter, unindexes the blob, the bytes are freed with the last payload reference */
+        struct stBlobRelease
+        {
+            std::weak_ptr<FSContentBlobStore> store;
+            std::uint64_t content_hash;
+            Blob_t payload; /* the bytes, shared by every store indexing them */
+
+            inline void operator()(const String_t *_blob) const noexcept
+            {
+                if (const std::shared_ptr<FSContentBlobStore> blob_store = store.lock())
+                    blob_store->__release(content_hash, _blob);
+            };
+        };
+
+        std::array<stBlobShard, FS_PROFILE_REGISTER_SHARDS> _shards;
+        std::atomic<std::size_t> _unique_bytes{0}; /* bytes of blobs with entries */
+        std::atomic<std::size_t> _unique_blobs{0}; /* blobs with entries */
+
+        /* count one more register entry on _slot, the blob is accounted with its first entry */
+        inline void __referenceLocked(stBlobSlot &_slot) noexcept
+        {
+            if (_slot.entries++ > 0)
+                return;
+            this->_unique_bytes.fetch_add(_slot.blob->size(), std::memory_order_relaxed);
+            this->_unique_blobs.fetch_add(1, std::memory_order_relaxed);
+        };
+
+        inline void __release(const std::uint64_t _content_hash, const String_t *_blob) noexcept
+        {
+            stBlobShard &shard(this->_shards[_content_hash & (FS_PROFILE_REGISTER_SHARDS - 1)]);
+            std::lock_guard<std::mutex> _lock(shard.blob_guard);
+            const auto [candidate_begin, candidate_end] = shard.blobs.equal_range(_content_hash);
+            for (auto candidate = candidate_begin; candidate != candidate_end; ++candidate)
+            {
+                if (candidate->second.blob == _blob)
+                {
+                    /* entries hold the blob alive, the last reference of an accounted blob cannot drop here */
+                    shard.blobs.erase(candidate);
+                    return;
+                }
+            }
+        };
+    };
+
+    /**
+     * @class FSShardedProfileRegister
+     * concurrent profile register, keys are spread over FS_PROFILE_REGISTER_SHARDS shards, each a
+     * key -> stResidentProfile map plus a recency order guarded by its own mutex, so lookups on
+     * distinct keys never contend. profiles are stored as immutable stProfileRecord instances,
+     * lookups hand out a ProfileHandle_t instead of copying content. residency is bounded by a byte
+     * budget and by FS_MAX_COLLECTION_STACK_SIZE entries, past either limit an approximately least
+     * recently used profile is evicted: ticks come from per shard counters aligned by an insertion
+     * epoch, hits only update the entry tick and the victim shard is picked from lock-free head
+     * ticks. with content deduplication enabled, contents are interned in a FSContentBlobStore and
+     * identical files registered under different keys share one buffer, resident bytes then
+     * account each content referenced by resident profiles once.
+     */
+    class FSShardedProfileRegister
+    {
+    public:
+        static_assert((FS_PROFILE_REGISTER_SHARDS & (FS_PROFILE_REGISTER_SHARDS - 1)) == 0, "FS_PROFILE_REGISTER_SHARDS must be a power of two");
+
+        FSShardedProfileRegister() = default;
+
+        FSShardedProfileRegister(const FSShardedProfileRegister &o)
+        {
+            this->__copyFrom(o);
+        };
+
+        FSShardedProfileRegister(FSShardedProfileRegister &&o) noexcept
+        {
+            this->__moveFrom(o);
+        };
+
+        FSShardedProfileRegister &operator=(const FSShardedProfileRegister &o)
+        {
+            if (this != &o)
+                this->__copyFrom(o);
+            return *this;
+        };
+
+        FSShardedProfileRegister &operator=(FSShardedProfileRegister &&o) noexcept
+        {
+            if (this != &o)
+                this->__moveFrom(o);
+            return *this;
+        };
+
+        /* shard owning _key */
+        static inline const std::size_t ShardIndex(const _FKType &_key) noexcept
+        {
+            const std::uint64_t key_hash(static_cast<std::uint64_t>(std::hash<_FKType>{}(_key)) * 0x9E3779B97F4A7C15ull);
+            return static_cast<std::size_t>(key_hash >> 32) & (FS_PROFILE_REGISTER_SHARDS - 1);
+        };
+
+        /* estimated resident footprint of _profile, key copy, record and node overhead included, content excluded when shared */
+        static inline const std::size_t ProfileFootprint(const struct stFileDescriptor &_profile, const bool _content_shared = false) noexcept
+        {
+            return (_content_shared ? 0 : _profile.file_content.size()) + _profile.file_name.size() * 2 + sizeof(struct stProfileRecord) + sizeof(String_t) + sizeof(_FKType) + 128;
+        };
+
+        /* build an immutable record from _profile, content is moved when passed as rvalue */
+        template <typename _DescriptorRef>
+        static inline ProfileHandle_t MakeRecord(_DescriptorRef &&_profile)
+        {
+            auto new_record(std::make_shared<struct stProfileRecord>());
+            new_record->file_name = _profile.file_name;
+            new_record->file_size = _profile.file_size;
+            new_record->file_content = std::make_shared<const String_t>(std::forward<_DescriptorRef>(_profile).file_content);
+            return new_record;
+        };
+
+        /**
+         *
+         * register _new_profile if its key is not present, least recently used profiles are evicted
+         * first when the budget or entry cap would be exceeded.
+         * @param stFileDescriptor the profile to register, moved from when passed as rvalue
+         * @returns bool true if the profile was inserted
+         */
+        template <typename _DescriptorRef>
+        inline const bool CreateProfile(_DescriptorRef &&_new_profile)
+        {
+            stRegisterShard &shard(this->_shards[ShardIndex(_new_profile.file_name)]);
+            {
+                /* duplicates are dropped before anything is evicted on their behalf */
+                std::lock_guard<std::mutex> _lock(shard.shard_guard);
+                if (shard.resident.find(_new_profile.file_name) != shard.resident.end())
+                    return false;
+            }
+            const std::size_t profile_bytes(ProfileFootprint(_new_profile));
+            if (!this->__reserveCapacity(profile_bytes, 1))
+                return false;
+            const bool content_dedup(this->_content_dedup.load(std::memory_order_relaxed));
+            const std::uint64_t content_hash(content_dedup ? FSContentHash::Hash(_new_profile.file_content.data(), _new_profile.file_content.size()) : 0);
+            bool inserted(false);
+            {
+                std::lock_guard<std::mutex> _lock(shard.shard_guard);
+                inserted = this->__insertLocked(shard, std::forward<_DescriptorRef>(_new_profile), content_dedup ? &content_hash : nullptr);
+            }
+            this->__reserveCapacity(0, 0);
+            return inserted;
+        };
+
+        /**
+         *
+         * bulk registration, _new_profiles are grouped by shard first and every shard is locked once
+         * for its whole group. resident keys and profiles larger than the budget are dropped before
+         * capacity is reserved, a group that does not fit the budget as a whole reserves per profile.
+         * @param std::vector<stFileDescriptor*>& profiles to register
+         * @param bool if true, profiles are moved into the register
+         * @returns void
+         */
+        inline void CreateProfiles(const std::vector<struct stFileDescriptor *> &_new_profiles, const bool _move_src)
+        {
+            std::array<std::vector<std::pair<struct stFileDescriptor *, std::uint64_t>>, FS_PROFILE_REGISTER_SHARDS> shard_groups;
+            const bool content_dedup(this->_content_dedup.load(std::memory_order_relaxed));
+            const std::size_t byte_budget(this->_byte_budget.load(std::memory_order_relaxed));
+            for (struct stFileDescriptor *new_profile : _new_profiles)
+                shard_groups[ShardIndex(new_profile->file_name)].emplace_back(new_profile, 0);
+
+            const auto insert_profile = [&](stRegisterShard &_shard, struct stFileDescriptor *_new_profile, const std::uint64_t &_content_hash) -> void
+            {
+                if (_move_src)
+                    this->__insertLocked(_shard, std::move(*_new_profile), content_dedup ? &_content_hash : nullptr);
+                else
+                    this->__insertLocked(_shard, *_new_profile, content_dedup ? &_content_hash : nullptr);
+            };
+
+            for (std::size_t shard_index = 0; shard_index < FS_PROFILE_REGISTER_SHARDS; ++shard_index)
+            {
+                auto &shard_group(shard_groups[shard_index]);
+                if (shard_group.empty())
+                    continue;
+                stRegisterShard &shard(this->_shards[shard_index]);
+                std::size_t shard_group_bytes(0);
+                {
+                    std::lock_guard<std::mutex> _lock(shard.shard_guard);
+                    const auto dropped_begin(std::remove_if(shard_group.begin(), shard_group.end(), [&](const std::pair<struct stFileDescriptor *, std::uint64_t> &_entry) -> bool
+                                                            {
+                        if (shard.resident.find(_entry.first->file_name) != shard.resident.end())
+                            return true;
+                        const std::size_t profile_bytes(ProfileFootprint(*_entry.first));
+                        if (byte_budget > 0 && profile_bytes > byte_budget) [[unlikely]]
+                        {
+                            this->_rejections.fetch_add(1, std::memory_order_relaxed);
+                            return true;
+                        }
+                        shard_group_bytes += profile_bytes;
+                        return false; }));
+                    shard_group.erase(dropped_begin, shard_group.end());
+                }
+                if (shard_group.empty())
+                    continue;
+                if (content_dedup)
+                    for (auto &[new_profile, content_hash] : shard_group)
+                        content_hash = FSContentHash::Hash(new_profile->file_content.data(), new_profile->file_content.size());
+
+                if (byte_budget > 0 && shard_group_bytes > byte_budget)
+                {
+                    /* the group alone overflows the budget, reserving for it at once would evict everything */
+                    for (const auto &[new_profile, content_hash] : shard_group)
+                    {
+                        this->__reserveCapacity(ProfileFootprint(*new_profile), 1);
+                        std::lock_guard<std::mutex> _lock(shard.shard_guard);
+                        insert_profile(shard, new_profile, content_hash);
+                    }
+                    continue;
+                }
+                this->__reserveCapacity(shard_group_bytes, shard_group.size());
+                std::lock_guard<std::mutex> _lock(shard.shard_guard);
+                for (const auto &[new_profile, content_hash] : shard_group)
+                    insert_profile(shard, new_profile, content_hash);
+            }
+            this->__reserveCapacity(0, 0);
+        };
+
+        /* shared handle to _profile_id, nullptr if absent, the shard lock is held for the tick and ref bump only */
+        inline ProfileHandle_t GetProfile(const _FKType &_profile_id)
+        {
+            stRegisterShard &shard(this->_shards[ShardIndex(_profile_id)]);
+            std::lock_guard<std::mutex> _lock(shard.shard_guard);
+            auto resident_entry(shard.resident.find(_profile_id));
+            if (resident_entry == shard.resident.end())
+            {
+                shard.misses.fetch_add(1, std::memory_order_relaxed);
+                FS_INSTRUMENT_COUNT(eIoCounter::REGISTER_MISSES, 1);
+                return nullptr;
+            }
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            FS_INSTRUMENT_COUNT(eIoCounter::REGISTER_HITS, 1);
+            resident_entry->second.access_tick = this->__nextTickLocked(shard); /* requeued lazily by __evictOldest */
+            return resident_entry->second.record;
+        };
+
+        inline void EraseProfile(const _FKType &_profile_id)
+        {
+            stRegisterShard &shard(this->_shards[ShardIndex(_profile_id)]);
+            std::lock_guard<std::mutex> _lock(shard.shard_guard);
+            this->__eraseLocked(shard, _profile_id);
+        };
+
+        inline const std::size_t Size(void) const noexcept
+        {
+            return this->_profile_count.load(std::memory_order_relaxed);
+        };
+
+        /* set the byte budget(0 disables it) and evict down to it right away */
+        inline void SetByteBudget(const std::size_t _byte_budget)
+        {
+            this->_byte_budget.store(_byte_budget, std::memory_order_relaxed);
+            this->__reserveCapacity(0, 0);
+        };
+
+        /* intern contents of profiles registered from now on in the shared blob store, resident profiles are left as they are */
+        inline void SetContentDedup(const bool _enabled) noexcept
+        {
+            this->_content_dedup.store(_enabled, std::memory_order_relaxed);
+        };
+
+        inline const bool ContentDedup(void) const noexcept
+        {
+            return this->_content_dedup.load(std::memory_order_relaxed);
+        };
+
+        inline const stRegisterStats Stats(void) const noexcept
+        {
+            const std::size_t content_bytes(this->_content_bytes.load(std::memory_order_relaxed));
+            const std::size_t unique_content_bytes(content_bytes - this->_shared_content_bytes.load(std::memory_order_relaxed) + this->_blob_store->UniqueBytes());
+            std::uint64_t hits(0), misses(0);
+            for (const stRegisterShard &shard : this->_shards)
+            {
+                hits += shard.hits.load(std::memory_order_relaxed);
+                misses += shard.misses.load(std::memory_order_relaxed);
+            }
+            return stRegisterStats{.entries = this->_profile_count.load(std::memory_order_relaxed),
+                                   .resident_bytes = this->__residentBytes(),
+                                   .byte_budget = this->_byte_budget.load(std::memory_order_relaxed),
+                                   .hits = hits,
+                                   .misses = misses,
+                                   .insertions = this->_insertions.load(std::memory_order_relaxed),
+                                   .evictions = this->_evictions.load(std::memory_order_relaxed),
+                                   .rejections = this->_rejections.load(std::memory_order_relaxed),
+                                   .content_bytes = content_bytes,
+                                   .unique_content_bytes = unique_content_bytes,
+                                   .dedup_hits = this->_dedup_hits.load(std::memory_order_relaxed),
+                                   .dedup_ratio = unique_content_bytes > 0 ? static_cast<double>(content_bytes) / static_cast<double>(unique_content_bytes) : 1.0};
+        };
+
+        /* handles to every resident profile, no content is copied, shards are locked one at a time */
+        inline const std::vector<ProfileHandle_t> Handles(void) const
+        {
+            std::vector<ProfileHandle_t> profile_handles;
+            profile_handles.reserve(this->Size());
+            for (const stRegisterShard &shard : this->_shards)
+            {
+                std::lock_guard<std::mutex> _lock(shard.shard_guard);
+                for (const auto &[fk, resident_profile] : shard.resident)
+                    profile_handles.push_back(resident_profile.record);
+            }
+            return profile_handles;
+        };
+
+        /* deep copy every shard into a single stProfilerStackRegister */
+        inline const struct stProfilerStackRegister Snapshot(void) const
+        {
+            struct stProfilerStackRegister merged_register;
+            merged_register.stack_register.reserve(this->Size());
+            for (const ProfileHandle_t &profile_handle : this->Handles())
+                merged_register.stack_register.emplace(profile_handle->file_name, profile_handle->ToDescriptor());
+            merged_register.reg_stack_size = merged_register.stack_register.size();
+            return merged_register;
+        };
+
+    private:
+        struct stResidentProfile
+        {
+            ProfileHandle_t record;      /* the shared immutable profile */
+            std::uint64_t access_tick;   /* last access tick */
+            std::uint64_t order_tick;    /* key within recency_order, lags access_tick until requeued */
+            std::size_t footprint;       /* accounted resident bytes, shared content excluded */
+            std::size_t content_size;    /* file content bytes */
+            bool shared_content;         /* content lives in the blob store */
+            std::uint64_t content_hash;  /* FSContentHash of the content, set when shared_content */
+        };
+
+        struct alignas(64) stRegisterShard
+        {
+            mutable std::mutex shard_guard;
+            std::unordered_map<_FKType, stResidentProfile> resident; /* key -> resident profile */
+            std::map<std::uint64_t, _FKType> recency_order;          /* order tick -> key, oldest first */
+            std::uint64_t access_clock{0};                           /* last tick handed out, guarded by shard_guard */
+            std::atomic<std::uint64_t> head_tick{std::numeric_limits<std::uint64_t>::max()}; /* first order tick, read without the lock */
+            std::atomic<std::uint64_t> hits{0};
+            std::atomic<std::uint64_t> misses{0};
+        };
+
+        std::array<stRegisterShard, FS_PROFILE_REGISTER_SHARDS> _shards;
+        std::atomic<std::size_t> _profile_count{0};
+        std::atomic<std::size_t> _resident_bytes{0};
+        std::atomic<std::size_t> _byte_budget{FS_REGISTER_BYTE_BUDGET};
+        std::atomic<std::uint64_t> _insertions{0};
+        std::atomic<std::uint64_t> _evictions{0};
+        std::atomic<std::uint64_t> _rejections{0};
+        std::atomic<std::uint64_t> _dedup_hits{0};
+        std::atomic<std::uint64_t> _access_epoch{0}; /* advanced per insertion, aligns the shard clocks */
+        std::atomic<std::size_t> _content_bytes{0};        /* content bytes of resident profiles */
+        std::atomic<std::size_t> _shared_content_bytes{0}; /* content bytes of resident profiles interned in _blob_store */
+        std::atomic<bool> _content_dedup{false};
+        std::shared_ptr<FSContentBlobStore> _blob_store{std::make_shared<FSContentBlobStore>()}; /* owned by this register, copies adopt its blobs into their own store */
+
+        /* accounted footprints plus bytes of content blobs referenced by resident profiles */
+        inline const std::size_t __residentBytes(void) const noexcept
+        {
+            return this->_resident_bytes.load(std::memory_order_relaxed) + this->_blob_store->UniqueBytes();
+        };
+
+        /**
+         *
+         * evict least recently used profiles until _incoming_bytes and _incoming_entries fit within
+         * the budget and entry cap, no shard lock may be held by the caller.
+         * @returns bool false if the incoming profile alone exceeds the budget
+         */
+        inline const bool __reserveCapacity(const std::size_t _incoming_bytes, const std::size_t _incoming_entries)
+        {
+            const std::size_t byte_budget(this->_byte_budget.load(std::memory_order_relaxed));
+            if (_incoming_entries == 1 && byte_budget > 0 && _incoming_bytes > byte_budget) [[unlikely]]
+            {
+                this->_rejections.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            const std::size_t entry_cap(FS_MAX_COLLECTION_STACK_SIZE - 2);
+            while ((byte_budget > 0 && this->__residentBytes() + _incoming_bytes > byte_budget) ||
+                   this->_profile_count.load(std::memory_order_relaxed) + _incoming_entries > entry_cap)
+            {
+                if (!this->__evictOldest())
+                    break;
+            }
+            return true;
+        };
+
+        /**
+         *
+         * evict an approximately least recently used profile, the shard with the oldest head tick is
+         * picked without locking the others. heads accessed since they were queued are requeued at
+         * their access tick first.
+         * @returns bool false if the register is empty
+         */
+        inline const bool __evictOldest(void)
+        {
+            for (;;)
+            {
+                std::size_t victim_shard(FS_PROFILE_REGISTER_SHARDS);
+                std::uint64_t victim_tick(std::numeric_limits<std::uint64_t>::max());
+                for (std::size_t shard_index = 0; shard_index < FS_PROFILE_REGISTER_SHARDS; ++shard_index)
+                {
+                    const std::uint64_t head_tick(this->_shards[shard_index].head_tick.load(std::memory_order_relaxed));
+                    if (head_tick < victim_tick)
+                    {
+                        victim_tick = head_tick;
+                        victim_shard = shard_index;
+                    }
+                }
+                if (victim_shard == FS_PROFILE_REGISTER_SHARDS)
+                    return false;
+                stRegisterShard &shard(this->_shards[victim_shard]);
+                std::lock_guard<std::mutex> _lock(shard.shard_guard);
+                bool head_requeued(false);
+                while (!shard.recency_order.empty())
+                {
+                    auto order_head(shard.recency_order.begin());
+                    stResidentProfile &resident_profile(shard.resident.find(order_head->second)->second);
+                    if (resident_profile.order_tick == resident_profile.access_tick)
+                        break;
+                    auto order_node(shard.recency_order.extract(order_head));
+                    order_node.key() = resident_profile.order_tick = resident_profile.access_tick;
+                    shard.recency_order.insert(std::move(order_node));
+                    head_requeued = true;
+                }
+                __publishHeadLocked(shard);
+                if (head_requeued || shard.recency_order.empty())
+                    continue; /* the head moved, another shard may hold the oldest profile now */
+                const _FKType victim_key(shard.recency_order.begin()->second);
+                this->__eraseLocked(shard, victim_key);
+                this->_evictions.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        };
+
+        /* insert _new_profile unless its key is resident, _content_hash is set when its content must be interned */
+        template <typename _DescriptorRef>
+        inline const bool __insertLocked(stRegisterShard &_shard, _DescriptorRef &&_new_profile, const std::uint64_t *_content_hash)
+        {
+            if (_shard.resident.find(_new_profile.file_name) != _shard.resident.end())
+                return false;
+            const bool shared_content(_content_hash != nullptr);
+            const std::size_t profile_bytes(ProfileFootprint(_new_profile, shared_content)), content_size(_new_profile.file_content.size());
+            const std::uint64_t access_tick(this->__nextTickLocked(_shard));
+            this->_access_epoch.fetch_add(1, std::memory_order_relaxed); /* later accesses on any shard tick past this insertion */
+            _shard.recency_order.emplace(access_tick, _new_profile.file_name);
+            __publishHeadLocked(_shard);
+            _FKType profile_key(_new_profile.file_name);
+
+            ProfileHandle_t new_record;
+            if (shared_content)
+            {
+                auto interned_record(std::make_shared<struct stProfileRecord>());
+                bool content_reused(false);
+                interned_record->file_name = _new_profile.file_name;
+                interned_record->file_size = _new_profile.file_size;
+                interned_record->file_content = this->_blob_store->Intern(std::forward<_DescriptorRef>(_new_profile).file_content, *_content_hash, content_reused);
+                if (content_reused)
+                    this->_dedup_hits.fetch_add(1, std::memory_order_relaxed);
+                this->_shared_content_bytes.fetch_add(content_size, std::memory_order_relaxed);
+                new_record = std::move(interned_record);
+            }
+            else
+            {
+                new_record = MakeRecord(std::forward<_DescriptorRef>(_new_profile));
+            }
+
+            _shard.resident.emplace(std::move(profile_key), stResidentProfile{std::move(new_record), access_tick, access_tick, profile_bytes, content_size, shared_content, shared_content ? *_content_hash : 0});
+            this->_profile_count.fetch_add(1, std::memory_order_relaxed);
+            this->_resident_bytes.fetch_add(profile_bytes, std::memory_order_relaxed);
+            this->_content_bytes.fetch_add(content_size, std::memory_order_relaxed);
+            this->_insertions.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        };
+
+        /* next access tick of _shard, a per shard counter strictly increasing within the shard, kept
+           at or above the insertion epoch so ticks of distinct shards stay roughly comparable */
+        inline const std::uint64_t __nextTickLocked(stRegisterShard &_shard) const noexcept
+        {
+            constexpr unsigned epoch_shift(24); /* ticks a shard hands out per epoch before running into the next one */
+            _shard.access_clock = std::max(_shard.access_clock + 1, this->_access_epoch.load(std::memory_order_relaxed) << epoch_shift);
+            return _shard.access_clock;
+        };
+
+        /* mirror the first order tick of _shard into head_tick */
+        static inline void __publishHeadLocked(stRegisterShard &_shard) noexcept
+        {
+            _shard.head_tick.store(_shard.recency_order.empty() ? std::numeric_limits<std::uint64_t>::max() : _shard.recency_order.begin()->first, std::memory_order_relaxed);
+        };
+
+        inline void __eraseLocked(stRegisterShard &_shard, const _FKType &_profile_id)
+        {
+            auto resident_entry(_shard.resident.find(_profile_id));
+            if (resident_entry == _shard.resident.end())
+                return;
+            this->_resident_bytes.fetch_sub(resident_entry->second.footprint, std::memory_order_relaxed);
+            this->_content_bytes.fetch_sub(resident_entry->second.content_size, std::memory_order_relaxed);
+            if (resident_entry->second.shared_content)
+            {
+                this->_shared_content_bytes.fetch_sub(resident_entry->second.content_size, std::memory_order_relaxed);
+                this->_blob_store->Unreference(resident_entry->second.record->file_content.get(), resident_entry->second.content_hash);
+            }
+            this->_profile_count.fetch_sub(1, std::memory_order_relaxed);
+            _shard.recency_order.erase(resident_entry->second.order_tick);
+            _shard.resident.erase(resident_entry);
+            __publishHeadLocked(_shard);
+        };
+
+        inline void __copyFrom(const FSShardedProfileRegister &o)
+        {
+            std::size_t copied_count(0), copied_bytes(0), copied_content(0), copied_shared(0);
+            this->_blob_store = std::make_shared<FSContentBlobStore>();
+            for (std::size_t shard_index = 0; shard_index < FS_PROFILE_REGISTER_SHARDS; ++shard_index)
+            {
+                std::scoped_lock _lock(this->_shards[shard_index].shard_guard, o._shards[shard_index].shard_guard);
+                stRegisterShard &shard(this->_shards[shard_index]);
+                const stRegisterShard &source(o._shards[shard_index]);
+                shard.resident = source.resident;
+                shard.recency_order = source.recency_order;
+                shard.access_clock = source.access_clock;
+                __publishHeadLocked(shard);
+                shard.hits.store(source.hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                shard.misses.store(source.misses.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                copied_count += shard.resident.size();
+                for (auto &[fk, resident_profile] : shard.resident)
+                {
+                    if (resident_profile.shared_content)
+                    {
+                        /* same bytes, indexed and accounted by this register's own store */
+                        auto adopted_record(std::make_shared<struct stProfileRecord>(*resident_profile.record));
+                        adopted_record->file_content = this->_blob_store->Adopt(resident_profile.record->file_content, resident_profile.content_hash);
+                        resident_profile.record = std::move(adopted_record);
+                    }
+                    copied_bytes += resident_profile.footprint;
+                    copied_content += resident_profile.content_size;
+                    copied_shared += resident_profile.shared_content ? resident_profile.content_size : 0;
+                }
+            }
+            this->__copyCounters(o, copied_count, copied_bytes, copied_content, copied_shared);
+        };
+
+        inline void __moveFrom(FSShardedProfileRegister &o) noexcept
+        {
+            std::size_t moved_count(0), moved_bytes(0), moved_content(0), moved_shared(0);
+            for (std::size_t shard_index = 0; shard_index < FS_PROFILE_REGISTER_SHARDS; ++shard_index)
+            {
+                std::scoped_lock _lock(this->_shards[shard_index].shard_guard, o._shards[shard_index].shard_guard);
+                stRegisterShard &shard(this->_shards[shard_index]);
+                stRegisterShard &source(o._shards[shard_index]);
+                shard.resident = std::move(source.resident);
+                shard.recency_order = std::move(source.recency_order);
+                shard.access_clock = source.access_clock;
+                shard.hits.store(source.hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                shard.misses.store(source.misses.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                source.resident.clear();
+                source.recency_order.clear();
+                __publishHeadLocked(shard);
+                __publishHeadLocked(source);
+                moved_count += shard.resident.size();
+                for (const auto &[fk, resident_profile] : shard.resident)
+                {
+                    moved_bytes += resident_profile.footprint;
+                    moved_content += resident_profile.content_size;
+                    moved_shared += resident_profile.shared_content ? resident_profile.content_size : 0;
+                }
+            }
+            this->__copyCounters(o, moved_count, moved_bytes, moved_content, moved_shared);
+            std::swap(this->_blob_store, o._blob_store);
+            o._profile_count.store(0, std::memory_order_relaxed);
+            o._resident_bytes.store(0, std::memory_order_relaxed);
+            o._content_bytes.store(0, std::memory_order_relaxed);
+            o._shared_content_bytes.store(0, std::memory_order_relaxed);
+        };
+
+        inline void __copyCounters(const FSShardedProfileRegister &o, const std::size_t _entries, const std::size_t _bytes, const std::size_t _content, const std::size_t _shared_content) noexcept
+        {
+            this->_profile_count.store(_entries, std::memory_order_relaxed);
+            this->_resident_bytes.store(_bytes, std::memory_order_relaxed);
+            this->_content_bytes.store(_content, std::memory_order_relaxed);
+            this->_shared_content_bytes.store(_shared_content, std::memory_order_relaxed);
+            this->_content_dedup.store(o._content_dedup.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            this->_dedup_hits.store(o._dedup_hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            this->_access_epoch.store(o._access_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            this->_byte_budget.store(o._byte_budget.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            this->_insertions.store(o._insertions.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            this->_evictions.store(o._evictions.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            this->_rejections.store(o._rejections.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        };
+    };
+
+    /*                  Work-Stealing Executor               *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     * @class FSWorkStealingPool
+     * fixed size worker pool, every worker owns a task deque, pops its own tasks LIFO and steals
+     * from the other workers FIFO when running dry. tasks submitted from inside a worker stay on
+     * that worker's deque, so recursive fan-out(directory expansion) keeps locality.
+     */
+    class FSWorkStealingPool
+    {
+    public:
+        using Task_t = std::function<void()>;
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        /* create pool with _worker_count workers, 0 uses hardware concurrency */
+        explicit FSWorkStealingPool(const std::size_t _worker_count = 0)
+        {
+            const std::size_t worker_total(_worker_count > 0 ? _worker_count : std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+            this->_queues.reserve(worker_total);
+            for (std::size_t w = 0; w < worker_total; ++w)
+                this->_queues.emplace_back(std::make_unique<stWorkerQueue>());
+            this->_workers.reserve(worker_total);
+            for (std::size_t w = 0; w < worker_total; ++w)
+                this->_workers.emplace_back([this, w]
+                                            { this->__workerLoop(w); });
+        };
+
+        FSWorkStealingPool(const FSWorkStealingPool &o) = delete;
+        FSWorkStealingPool &operator=(const FSWorkStealingPool &o) = delete;
+
+        /**
+         *
+         * queue _task, lands on the calling worker's deque when called from a worker of this pool,
+         * round-robin across workers otherwise.
+         * @param Task_t the task to run
+         * @returns void
+         */
+        inline void Submit(Task_t _task)
+        {
+            const std::size_t current(this->CurrentWorkerIndex());
+            const std::size_t target(current != npos ? current : this->_next_queue.fetch_add(1, std::memory_order_relaxed) % this->_queues.size());
+            {
+                std::lock_guard<std::mutex> _lock(this->_queues[target]->mtx);
+                this->_queues[target]->tasks.push_back(std::move(_task));
+            }
+            this->_queued.fetch_add(1, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> _lock(this->_sleep_mtx);
+            }
+            this->_sleep_cv.notify_one();
+        };
+
+        /**
+         *
+         * run one queued task on the calling thread if any is available, used by waiting threads
+         * to help instead of blocking.
+         * @returns bool true if a task was executed
+         */
+        inline const bool RunPendingTask(void)
+        {
+            Task_t task;
+            const std::size_t current(this->CurrentWorkerIndex());
+            if (!this->__acquireTask(current != npos ? current : 0, task))
+                return false;
+            task();
+            return true;
+        };
+
+        /* index of the calling worker within this pool, npos for foreign threads */
+        inline const std::size_t CurrentWorkerIndex(void) const noexcept
+        {
+            return _tl_owner == this ? _tl_worker_index : npos;
+        };
+
+        inline const std::size_t WorkerCount(void) const noexcept
+        {
+            return this->_workers.size();
+        };
+
+        ~FSWorkStealingPool() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> _lock(this->_sleep_mtx);
+                this->_stopping = true;
+            }
+            this->_sleep_cv.notify_all();
+            for (std::thread &worker : this->_workers)
+                if (worker.joinable())
+                    worker.join();
+        };
+
+    private:
+        struct stWorkerQueue
+        {
+            std::mutex mtx;
+            std::deque<Task_t> tasks;
+        };
+
+        std::vector<std::unique_ptr<stWorkerQueue>> _queues;
+        std::vector<std::thread> _workers;
+        std::atomic<std::size_t> _queued{0};
+        std::atomic<std::size_t> _next_queue{0};
+        std::mutex _sleep_mtx;
+        std::condition_variable _sleep_cv;
+        bool _stopping{false};
+
+        static inline thread_local const FSWorkStealingPool *_tl_owner{nullptr};
+        static inline thread_local std::size_t _tl_worker_index{npos};
+
+        /* pop from own deque back, then steal from the front of the others */
+        inline const bool __acquireTask(const std::size_t _home, Task_t &_task)
+        {
+            if (this->_queued.load(std::memory_order_acquire) == 0)
+                return false;
+            {
+                stWorkerQueue &own(*this->_queues[_home]);
+                std::lock_guard<std::mutex> _lock(own.mtx);
+                if (!own.tasks.empty())
+                {
+                    _task = std::move(own.tasks.back());
+                    own.tasks.pop_back();
+                    this->_queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            for (std::size_t offset = 1; offset < this->_queues.size(); ++offset)
+            {
+                stWorkerQueue &victim(*this->_queues[(_home + offset) % this->_queues.size()]);
+                std::lock_guard<std::mutex> _lock(victim.mtx);
+                if (!victim.tasks.empty())
+                {
+                    _task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    this->_queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        inline void __workerLoop(const std::size_t _index)
+        {
+            _tl_owner = this;
+            _tl_worker_index = _index;
+            Task_t task;
+            while (true)
+            {
+                if (this->__acquireTask(_index, task))
+                {
+                    task();
+                    task = nullptr;
+                    continue;
+                }
+                std::unique_lock<std::mutex> _lock(this->_sleep_mtx);
+                this->_sleep_cv.wait(_lock, [this]
+                                     { return this->_stopping || this->_queued.load(std::memory_order_acquire) > 0; });
+                if (this->_stopping && this->_queued.load(std::memory_order_acquire) == 0)
+                    return;
+            }
+        };
+    };
+
+    /**
+     * @class FSTaskGroup
+     * tracks a set of tasks submitted to a FSWorkStealingPool. tasks are kept in a queue owned by
+     * the group and the pool only receives tickets that pop from it, so Wait() helps by running
+     * queued tasks of this group alone, never unrelated pool work(other operations, callbacks),
+     * until every task of the group has completed. first exception thrown by a task is rethrown.
+     */
+    class FSTaskGroup
+    {
+    public:
+        explicit FSTaskGroup(FSWorkStealingPool &_pool) : _pool(_pool), _state(std::make_shared<stGroupState>()) {};
+
+        FSTaskGroup(const FSTaskGroup &o) = delete;
+        FSTaskGroup &operator=(const FSTaskGroup &o) = delete;
+
+        inline void Run(FSWorkStealingPool::Task_t _task)
+        {
+            {
+                std::lock_guard<std::mutex> _lock(this->_state->mtx);
+                this->_state->pending.push_back(std::move(_task));
+                ++this->_state->outstanding;
+            }
+            this->_state->done_cv.notify_all();
+            /* a ticket outliving the group finds the queue empty, it only holds the shared state */
+            this->_pool.Submit([group_state = this->_state]
+                               { __runPending(*group_state); });
+        };
+
+        inline void Wait(void)
+        {
+            std::unique_lock<std::mutex> _lock(this->_state->mtx);
+            while (true)
+            {
+                if (!this->_state->pending.empty())
+                {
+                    FSWorkStealingPool::Task_t task(std::move(this->_state->pending.back()));
+                    this->_state->pending.pop_back();
+                    _lock.unlock();
+                    __execute(*this->_state, task);
+                    _lock.lock();
+                    continue;
+                }
+                if (this->_state->outstanding == 0)
+                    break;
+                this->_state->done_cv.wait(_lock, [this]
+                                           { return this->_state->outstanding == 0 || !this->_state->pending.empty(); });
+            }
+            if (this->_state->error)
+                std::rethrow_exception(std::exchange(this->_state->error, nullptr));
+        };
+
+        ~FSTaskGroup() noexcept
+        {
+            try
+            {
+                this->Wait();
+            }
+            catch (...)
+            {
+            }
+        };
+
+    private:
+        struct stGroupState
+        {
+            std::mutex mtx;
+            std::condition_variable done_cv;
+            std::deque<FSWorkStealingPool::Task_t> pending; /* tasks not started yet, newest at the back */
+            std::size_t outstanding{0};                     /* tasks queued or running */
+            std::exception_ptr error{nullptr};
+        };
+
+        FSWorkStealingPool &_pool;
+        std::shared_ptr<stGroupState> _state;
+
+        /* pool ticket, runs the newest queued task of the group if Wait() did not take it already */
+        static inline void __runPending(stGroupState &_state)
+        {
+            FSWorkStealingPool::Task_t task;
+            {
+                std::lock_guard<std::mutex> _lock(_state.mtx);
+                if (_state.pending.empty())
+                    return;
+                task = std::move(_state.pending.back());
+                _state.pending.pop_back();
+            }
+            __execute(_state, task);
+        };
+
+        static inline void __execute(stGroupState &_state, FSWorkStealingPool::Task_t &_task)
+        {
+            std::exception_ptr task_error{nullptr};
+            try
+            {
+                _task();
+            }
+            catch (...)
+            {
+                task_error = std::current_exception();
+            }
+            _task = nullptr; /* captures are released before the group may be reported done */
+            std::lock_guard<std::mutex> _lock(_state.mtx);
+            if (task_error && !_state.error)
+                _state.error = task_error;
+            if (--_state.outstanding == 0)
+                _state.done_cv.notify_all();
+        };
+    };
+
+    /*                  Async Execution                      *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /* thrown(through the future) by async operations stopped by their cancellation token */
+    class FSOperationCancelled : public std::runtime_error
+    {
+    public:
+        FSOperationCancelled() : std::runtime_error("operation cancelled") {};
+    };
+
+    /**
+     * @class FSCancellationToken
+     * cooperative cancellation flag shared by every copy of the token, operations poll it between
+     * units of work(files, chunks, directories), work already started on a unit is completed.
+     */
+    class FSCancellationToken
+    {
+    public:
+        inline void Cancel(void) const noexcept { _cancelled->store(true, std::memory_order_relaxed); };
+        inline const bool Cancelled(void) const noexcept { return _cancelled->load(std::memory_order_relaxed); };
+
+    private:
+        std::shared_ptr<std::atomic<bool>> _cancelled{std::make_shared<std::atomic<bool>>(false)};
+    };
+
+    typedef struct alignas(void *)
+    {
+        std::size_t completed{0}; /* units done, bytes for file reads/writes, files or directories otherwise */
+        std::size_t total{0};     /* units known so far, grows while directory walks discover work */
+    } stAsyncProgress;
+
+    using asyncProgressCallback_t = std::function<void(const stAsyncProgress &)>;
+
+    template <typename _Result>
+    using asyncCallback_t = std::function<void(std::future<_Result>)>; /* receives the ready future, get() returns the result or rethrows */
+
+    typedef struct alignas(void *)
+    {
+        FSCancellationToken cancel_token{};
+        asyncProgressCallback_t on_progress{nullptr}; /* invocations are serialized, keep it short */
+    } stAsyncOptions;
+
+    /* per operation cancellation and progress state, internal operations take it as an optional pointer */
+    struct stOperationControl
+    {
+        explicit stOperationControl(const stAsyncOptions &_options) noexcept : _options(_options) {};
+        stOperationControl(const stOperationControl &o) = delete;
+        stOperationControl &operator=(const stOperationControl &o) = delete;
+
+        inline const bool Cancelled(void) const noexcept { return _options.cancel_token.Cancelled(); };
+
+        inline void ThrowIfCancelled(void) const
+        {
+            if (Cancelled())
+                throw FSOperationCancelled();
+        };
+
+        inline void AddTotal(const std::size_t _units) noexcept { _total.fetch_add(_units, std::memory_order_relaxed); };
+
+        inline void Advance(const std::size_t _units)
+        {
+            const std::size_t completed(_completed.fetch_add(_units, std::memory_order_relaxed) + _units);
+            if (!_options.on_progress)
+                return;
+            std::lock_guard<std::mutex> _lock(_progress_guard);
+            _options.on_progress(stAsyncProgress{.completed = completed, .total = std::max(completed, _total.load(std::memory_order_relaxed))});
+        };
+
+    private:
+        const stAsyncOptions &_options;
+        std::atomic<std::size_t> _completed{0};
+        std::atomic<std::size_t> _total{0};
+        std::mutex _progress_guard;
+    };
+
+    /**
+     * @class FSAsyncExecutor
+     * bounded executor running async operations, a work-stealing pool of FS_ASYNC_WORKERS workers
+     * with at most FS_ASYNC_MAX_PENDING operations queued or running. Post() from a foreign thread
+     * blocks while the bound is reached, callers that must not block(coroutine awaiters) park the
+     * operation instead, it starts in the slot of the next operation to complete. operations run
+     * their inner parallel work(directory expansion, file batches) on the same pool, a waiting
+     * operation helps with its own tasks instead of blocking.
+     */
+    class FSAsyncExecutor
+    {
+    public:
+        /* process-wide executor shared by every FSController instance */
+        static FSAsyncExecutor &Shared(void)
+        {
+#if defined(FS_HAS_INSTRUMENTATION)
+            (void)FSInstrumentation::Shared(); /* constructed first, so it is destroyed after the workers retired their blocks */
+#endif
+            static FSAsyncExecutor shared_executor(FS_ASYNC_WORKERS, FS_ASYNC_MAX_PENDING);
+            return shared_executor;
+        };
+
+        FSAsyncExecutor(const std::size_t _worker_count, const std::size_t _max_pending) : _max_pending(std::max<std::size_t>(1, _max_pending)), _pool(_worker_count) {};
+
+        FSAsyncExecutor(const FSAsyncExecutor &o) = delete;
+        FSAsyncExecutor &operator=(const FSAsyncExecutor &o) = delete;
+
+        /**
+         *
+         * queue _task as one operation, blocks while FS_ASYNC_MAX_PENDING operations are pending
+         * unless called from a worker of the executor(which would otherwise wait on itself). with
+         * _wait_for_capacity false the caller never blocks, past the bound _task is parked and
+         * started once a slot frees up, parked operations go before blocked submitters.
+         * @param FSWorkStealingPool::Task_t the operation, exceptions must be handled by the task
+         * @param bool optional! if false, park instead of blocking the caller
+         * @returns void
+         */
+        inline void Post(FSWorkStealingPool::Task_t _task, const bool _wait_for_capacity = true)
+        {
+            {
+                std::unique_lock<std::mutex> _lock(this->_pending_guard);
+                if (this->_pool.CurrentWorkerIndex() == FSWorkStealingPool::npos)
+                {
+                    if (!_wait_for_capacity && this->_pending >= this->_max_pending)
+                    {
+                        this->_parked.push_back(std::move(_task));
+                        return;
+                    }
+                    this->_pending_cv.wait(_lock, [this]
+                                           { return this->_pending < this->_max_pending; });
+                }
+                ++this->_pending;
+            }
+            this->__launch(std::move(_task));
+        };
+
+        inline FSWorkStealingPool &Pool(void) noexcept { return this->_pool; };
+
+        inline const std::size_t Pending(void) noexcept
+        {
+            std::lock_guard<std::mutex> _lock(this->_pending_guard);
+            return this->_pending;
+        };
+
+        /* operations parked past the bound, not started yet */
+        inline const std::size_t Parked(void) noexcept
+        {
+            std::lock_guard<std::mutex> _lock(this->_pending_guard);
+            return this->_parked.size();
+        };
+
+    private:
+        const std::size_t _max_pending;
+        std::size_t _pending{0};
+        std::deque<FSWorkStealingPool::Task_t> _parked; /* oldest first */
+        std::mutex _pending_guard;
+        std::condition_variable _pending_cv;
+        FSWorkStealingPool _pool; /* declared last, joined first while the pending state is still alive */
+
+        /* run _task on the pool, its slot passes to the oldest parked operation once it completed */
+        inline void __launch(FSWorkStealingPool::Task_t _task)
+        {
+            this->_pool.Submit([this, task = std::move(_task)]
+                               {
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                }
+                FSWorkStealingPool::Task_t parked_task;
+                {
+                    std::lock_guard<std::mutex> _lock(this->_pending_guard);
+                    if (this->_parked.empty())
+                        --this->_pending;
+                    else
+                    {
+                        parked_task = std::move(this->_parked.front());
+                        this->_parked.pop_front();
+                    }
+                }
+                if (parked_task)
+                    this->__launch(std::move(parked_task));
+                else
+                    this->_pending_cv.notify_one(); });
+        };
+    };
+
+#if defined(FS_HAS_COROUTINES)
+
+    /*                      Coroutines                       *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    template <typename _Result>
+    class FSTask;
+
+    /* result/exception slot of a coroutine promise, specialized for void */
+    template <typename _Result>
+    struct stTaskResult
+    {
+        std::optional<_Result> value{};
+        std::exception_ptr error{nullptr};
+
+        template <typename _Value>
+        inline void return_value(_Value &&_value) { value.emplace(std::forward<_Value>(_value)); };
+
+        inline _Result Take(void)
+        {
+            if (error)
+                std::rethrow_exception(error);
+            return std::move(*value);
+        };
+    };
+
+    template <>
+    struct stTaskResult<void>
+    {
+        std::exception_ptr error{nullptr};
+
+        inline void return_void(void) noexcept {};
+
+        inline void Take(void)
+        {
+            if (error)
+                std::rethrow_exception(error);
+        };
+    };
+
+    /**
+     * @class FSTask
+     * lazy coroutine task, the body starts when the task is awaited(or passed to SyncWait) and the
+     * awaiting coroutine is resumed by symmetric transfer when it completes. move-only, the frame
+     * is destroyed with the task.
+     */
+    template <typename _Result = void>
+    class FSTask
+    {
+    public:
+        struct promise_type : stTaskResult<_Result>
+        {
+            std::coroutine_handle<> continuation{nullptr};
+            std::shared_ptr<std::promise<void>> completion{nullptr}; /* set by SyncWait */
+
+            inline FSTask get_return_object(void) noexcept { return FSTask(std::coroutine_handle<promise_type>::from_promise(*this)); };
+            inline std::suspend_always initial_suspend(void) const noexcept { return {}; };
+            inline void unhandled_exception(void) noexcept { this->error = std::current_exception(); };
+
+            struct stFinalAwaiter
+            {
+                inline bool await_ready(void) const noexcept { return false; };
+                inline std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> _handle) const noexcept
+                {
+                    promise_type &task_promise(_handle.promise());
+                    if (task_promise.continuation)
+                        return task_promise.continuation;
+                    if (task_promise.completion)
+                    {
+                        const std::shared_ptr<std::promise<void>> completion(task_promise.completion); /* the frame may be gone once set */
+                        completion->set_value();
+                    }
+                    return std::noop_coroutine();
+                };
+                inline void await_resume(void) const noexcept {};
+            };
+
+            inline stFinalAwaiter final_suspend(void) const noexcept { return {}; };
+        };
+
+        FSTask(FSTask &&o) noexcept : _handle(std::exchange(o._handle, nullptr)) {};
+        FSTask &operator=(FSTask &&o) noexcept
+        {
+            if (this != &o)
+            {
+                if (this->_handle)
+                    this->_handle.destroy();
+                this->_handle = std::exchange(o._handle, nullptr);
+            }
+            return *this;
+        };
+        FSTask(const FSTask &o) = delete;
+        FSTask &operator=(const FSTask &o) = delete;
+
+        ~FSTask()
+        {
+            if (this->_handle)
+                this->_handle.destroy();
+        };
+
+        inline bool await_ready(void) const noexcept { return !this->_handle || this->_handle.done(); };
+
+        inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> _awaiting) noexcept
+        {
+            this->_handle.promise().continuation = _awaiting;
+            return this->_handle;
+        };
+
+        inline _Result await_resume(void) { return this->_handle.promise().Take(); };
+
+        /**
+         *
+         * Run the task to completion from a non-coroutine context, blocking the calling thread.
+         * @returns _Result the task result, rethrows the task exception
+         */
+        inline _Result SyncWait(void)
+        {
+            if (!this->_handle.done())
+            {
+                std::shared_ptr<std::promise<void>> completion(std::make_shared<std::promise<void>>());
+                std::future<void> completed(completion->get_future());
+                this->_handle.promise().completion = completion;
+                this->_handle.resume();
+                completed.wait();
+            }
+            return this->_handle.promise().Take();
+        };
+
+    private:
+        explicit FSTask(std::coroutine_handle<promise_type> _h) noexcept : _handle(_h) {};
+
+        std::coroutine_handle<promise_type> _handle{nullptr};
+    };
+
+    /**
+     * @class FSOperationAwaitable
+     * awaiter of one FSController async operation, the operation is posted to the FSAsyncExecutor
+     * when awaited and the awaiting coroutine resumes on the executor worker that completed it, no
+     * thread is blocked in between. past FS_ASYNC_MAX_PENDING the operation is parked by the
+     * executor, the coroutine stays suspended until a slot frees up.
+     * co_await yields the result or rethrows the operation error.
+     */
+    template <typename _Result>
+    class FSOperationAwaitable
+    {
+    public:
+        using launcher_t = std::function<void(asyncCallback_t<_Result>)>;
+
+        explicit FSOperationAwaitable(launcher_t _launcher) noexcept : _launcher(std::move(_launcher)) {};
+
+        inline bool await_ready(void) const noexcept { return false; };
+
+        inline void await_suspend(std::coroutine_handle<> _awaiting)
+        {
+            /* the callback may resume(and destroy) the awaiting frame before launch returns, launch from the stack */
+            const launcher_t launcher(std::move(this->_launcher));
+            launcher([this, _awaiting](std::future<_Result> _completed)
+                            {
+                this->_completed = std::move(_completed);
+                _awaiting.resume(); });
+        };
+
+        inline _Result await_resume(void) { return this->_completed.get(); };
+
+    private:
+        launcher_t _launcher;
+        std::future<_Result> _completed{};
+    };
+
+#endif
+
+    /*                  Directory Walker                     *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    enum class eDirEntryType : uint8_t
+    {
+        UNKNOWN = 0,
+        REGULAR,
+        DIRECTORY,
+        SYMLINK,
+        OTHER
+    };
+
+    enum class eWalkAction : uint8_t
+    {
+        CONTINUE = 0,
+        SKIP_SUBTREE,
+        STOP
+    };
+
+    typedef struct alignas(void *)
+    {
+        bool recursive{true};    /* descend into subdirectories */
+        bool post_order{false};  /* visit directories a second time once their content was walked */
+        bool skip_errors{false}; /* silently skip directories that cannot be opened or read */
+        std::size_t *skipped_directories{nullptr}; /* optional! incremented for every directory skipped by skip_errors */
+    } stWalkOptions;
+
+    /* stWalkEntry::StatFields request bits, only the requested fields are guaranteed to be filled */
+    enum eStatField : uint32_t
+    {
+        STAT_FIELD_TYPE = 1u << 0,
+        STAT_FIELD_SIZE = 1u << 1,
+        STAT_FIELD_BLOCKS = 1u << 2,
+        STAT_FIELD_INODE = 1u << 3,
+        STAT_FIELD_NLINK = 1u << 4,
+        STAT_FIELD_MTIME = 1u << 5
+    };
+
+    typedef struct alignas(void *)
+    {
+        mode_t mode{0};          /* file type bits(and permissions when available) */
+        std::uint64_t size{0};   /* apparent size */
+        std::uint64_t blocks{0}; /* allocated 512 byte blocks */
+        std::uint64_t device{0}; /* always filled */
+        std::uint64_t inode{0};
+        std::uint64_t nlink{0};
+        struct timespec mtime{};
+    } stEntryStat;
+
+    /**
+     *
+     * directory entry handed to walker visitors, views are only valid during the visit, parent_fd
+     * is the open directory holding the entry and can be used with the *at() syscall family.
+     */
+    struct alignas(void *) stWalkEntry
+    {
+        StringView_t path{};     /* full path, walk root + relative */
+        StringView_t relative{}; /* path relative to the walk root */
+        StringView_t name{};     /* entry name, NUL terminated */
+        int parent_fd{-1};       /* descriptor of the directory containing the entry */
+        std::uint64_t inode{0};  /* inode number reported by the directory stream */
+        eDirEntryType type{eDirEntryType::UNKNOWN};
+        std::size_t depth{0};    /* 0 for direct children of the walk root */
+        bool post_visit{false};  /* true on the post-order visit of a directory */
+
+        /* stat the entry relative to its parent directory */
+        inline const bool Stat(struct stat &_stat, const bool _follow_symlink = false) const noexcept
+        {
+            return fstatat(parent_fd, name.data(), &_stat, _follow_symlink ? 0 : AT_SYMLINK_NOFOLLOW) == 0;
+        };
+
+        /* stat only the requested eStatField bits, statx with a minimal mask on linux */
+        inline const bool StatFields(stEntryStat &_stat, const uint32_t _fields, const bool _follow_symlink = false) const noexcept
+        {
+#if defined(__linux__) && defined(STATX_BASIC_STATS)
+            unsigned int statx_mask(0);
+            statx_mask |= (_fields & STAT_FIELD_TYPE) ? STATX_TYPE : 0;
+            statx_mask |= (_fields & STAT_FIELD_SIZE) ? STATX_SIZE : 0;
+            statx_mask |= (_fields & STAT_FIELD_BLOCKS) ? STATX_BLOCKS : 0;
+            statx_mask |= (_fields & STAT_FIELD_INODE) ? STATX_INO : 0;
+            statx_mask |= (_fields & STAT_FIELD_NLINK) ? STATX_NLINK : 0;
+            statx_mask |= (_fields & STAT_FIELD_MTIME) ? STATX_MTIME : 0;
+            struct statx entry_statx;
+            if (statx(parent_fd, name.data(), AT_STATX_DONT_SYNC | (_follow_symlink ? 0 : AT_SYMLINK_NOFOLLOW), statx_mask, &entry_statx) != 0)
+                return false;
+            _stat.mode = entry_statx.stx_mode;
+            _stat.size = entry_statx.stx_size;
+            _stat.blocks = entry_statx.stx_blocks;
+            _stat.device = makedev(entry_statx.stx_dev_major, entry_statx.stx_dev_minor);
+            _stat.inode = entry_statx.stx_ino;
+            _stat.nlink = entry_statx.stx_nlink;
+            _stat.mtime = {static_cast<time_t>(entry_statx.stx_mtime.tv_sec), static_cast<long>(entry_statx.stx_mtime.tv_nsec)};
+#else
+            struct stat entry_stat;
+            if (!Stat(entry_stat, _follow_symlink))
+                return false;
+            _stat.mode = entry_stat.st_mode;
+            _stat.size = static_cast<std::uint64_t>(entry_stat.st_size);
+            _stat.blocks = static_cast<std::uint64_t>(entry_stat.st_blocks);
+            _stat.device = static_cast<std::uint64_t>(entry_stat.st_dev);
+            _stat.inode = static_cast<std::uint64_t>(entry_stat.st_ino);
+            _stat.nlink = static_cast<std::uint64_t>(entry_stat.st_nlink);
+#if defined(__APPLE__)
+            _stat.mtime = entry_stat.st_mtimespec;
+#else
+            _stat.mtime = entry_stat.st_mtim;
+#endif
+#endif
+            return true;
+        };
+
+        /* entry type with symlinks resolved to their target type, costs a stat for symlinks only */
+        inline const eDirEntryType ResolvedType(void) const noexcept
+        {
+            if (type != eDirEntryType::SYMLINK)
+                return type;
+            struct stat target_stat;
+            return Stat(target_stat, true) ? ModeToType(target_stat.st_mode) : eDirEntryType::UNKNOWN;
+        };
+
+        static inline const eDirEntryType ModeToType(const mode_t _mode) noexcept
+        {
+            if (S_ISREG(_mode))
+                return eDirEntryType::REGULAR;
+            if (S_ISDIR(_mode))
+                return eDirEntryType::DIRECTORY;
+            if (S_ISLNK(_mode))
+                return eDirEntryType::SYMLINK;
+            return eDirEntryType::OTHER;
+        };
+    };
+
+    /**
+     * @class FSDirectoryWalker
+     * low level directory walker, works on directory descriptors(openat/fstatat) and reads entries
+     * in large batches(getdents64 on linux), uses d_type to avoid stat calls whenever the filesystem
+     * reports it and builds entry paths incrementally within a single reused buffer. symlinked
+     * directories are reported but never descended into.
+     */
+    class FSDirectoryWalker
+    {
+    public:
+        /**
+         *
+         * Walk _root, calling _visitor for every entry, _visitor returns eWalkAction(or void for
+         * always continue).
+         * @param StringView_t& the directory to walk
+         * @param stWalkOptions& walk options
+         * @param _Visitor visitor invoked with const stWalkEntry&
+         * @returns bool false if the walk was stopped by the visitor
+         *
+         * @throws std::filesystem::filesystem_error If a directory cannot be opened or read and
+         * skip_errors is not set.
+         */
+        template <typename _Visitor>
+        static const bool Walk(const StringView_t &_root, const stWalkOptions &_options, _Visitor &&_visitor)
+        {
+            String_t path_buffer(_root);
+            while (path_buffer.size() > 1 && path_buffer.back() == '/')
+                path_buffer.pop_back();
+
+            stScopedDescriptor root_descriptor{open(path_buffer.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)};
+            if (root_descriptor.fd == -1)
+            {
+                if (_options.skip_errors)
+                {
+                    if (_options.skipped_directories != nullptr)
+                        ++*_options.skipped_directories;
+                    return true;
+                }
+                throw std::filesystem::filesystem_error("Cannot open directory", path_buffer, std::error_code(errno, std::generic_category()));
+            }
+            path_buffer.reserve(FS_MAX_FILE_NAME_LENGTH * 2);
+
+            stWalkState<_Visitor> walk_state{_options, _visitor, path_buffer, path_buffer.size() == 1 && path_buffer[0] == '/' ? 1 : path_buffer.size() + 1, {}};
+            return __walkLevel(walk_state, root_descriptor.fd, 0);
+        };
+
+    private:
+        template <typename _Visitor>
+        struct stWalkState
+        {
+            const stWalkOptions &options;
+            _Visitor &visitor;
+            String_t &path;
+            std::size_t relative_offset;                      /* where the relative part starts within path */
+            std::vector<std::unique_ptr<char[]>> dir_buffers; /* one read buffer per depth level */
+        };
+
+#if defined(__linux__)
+        struct stLinuxDirent64
+        {
+            std::uint64_t d_ino;
+            std::int64_t d_off;
+            unsigned short d_reclen;
+            unsigned char d_type;
+            char d_name[256];
+        };
+#endif
+
+        static inline const eDirEntryType __direntToType(const unsigned char _d_type) noexcept
+        {
+            switch (_d_type)
+            {
+            case DT_REG:
+                return eDirEntryType::REGULAR;
+            case DT_DIR:
+                return eDirEntryType::DIRECTORY;
+            case DT_LNK:
+                return eDirEntryType::SYMLINK;
+            case DT_UNKNOWN:
+                return eDirEntryType::UNKNOWN;
+            default:
+                return eDirEntryType::OTHER;
+            }
+        };
+
+        template <typename _Visitor>
+        static const bool __walkLevel(stWalkState<_Visitor> &_state, const int _dir_fd, const std::size_t _depth)
+        {
+            FS_INSTRUMENT_COUNT(eIoCounter::DIRECTORIES_WALKED, 1);
+            const std::size_t base_length(_state.path.size());
+#if defined(__linux__)
+            if (_state.dir_buffers.size() <= _depth)
+                _state.dir_buffers.emplace_back(std::make_unique<char[]>(FS_WALKER_BUFFER_SIZE));
+            char *dir_buffer(_state.dir_buffers[_depth].get());
+            while (true)
+            {
+                const long read_bytes(syscall(SYS_getdents64, _dir_fd, dir_buffer, FS_WALKER_BUFFER_SIZE));
+                if (read_bytes == -1)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    if (_state.options.skip_errors)
+                    {
+                        if (_state.options.skipped_directories != nullptr)
+                            ++*_state.options.skipped_directories;
+                        break;
+                    }
+                    throw std::filesystem::filesystem_error("Cannot read directory", _state.path.substr(0, base_length), std::error_code(errno, std::generic_category()));
+                }
+                if (read_bytes == 0)
+                    break;
+                for (long record_offset = 0; record_offset < read_bytes;)
+                {
+                    const stLinuxDirent64 *record(reinterpret_cast<const stLinuxDirent64 *>(dir_buffer + record_offset));
+                    record_offset += record->d_reclen;
+                    if (!__visitRecord(_state, _dir_fd, base_length, record->d_name, record->d_ino, record->d_type, _depth))
+                        return false;
+                }
+            }
+#else
+            const int stream_fd(dup(_dir_fd));
+            DIR *dir_stream(stream_fd != -1 ? fdopendir(stream_fd) : nullptr);
+            if (dir_stream == nullptr)
+            {
+                if (stream_fd != -1)
+                    close(stream_fd);
+                if (_state.options.skip_errors)
+                {
+                    if (_state.options.skipped_directories != nullptr)
+                        ++*_state.options.skipped_directories;
+                    return true;
+                }
+                throw std::filesystem::filesystem_error("Cannot read directory", _state.path.substr(0, base_length), std::error_code(errno, std::generic_category()));
+            }
+            std::unique_ptr<DIR, int (*)(DIR *)> dir_guard(dir_stream, closedir);
+            while (const struct dirent *record = readdir(dir_stream))
+            {
+                if (!__visitRecord(_state, _dir_fd, base_length, record->d_name, record->d_ino, record->d_type, _depth))
+                    return false;
+            }
+#endif
+            return true;
+        };
+
+        template <typename _Visitor>
+        static const bool __visitRecord(stWalkState<_Visitor> &_state, const int _dir_fd, const std::size_t _base_length, const char *_name, const std::uint64_t _inode, const unsigned char _d_type, const std::size_t _depth)
+        {
+            if (_name[0] == '.' && (_name[1] == '\0' || (_name[1] == '.' && _name[2] == '\0')))
+                return true;
+            FS_INSTRUMENT_COUNT(eIoCounter::ENTRIES_WALKED, 1);
+
+            eDirEntryType entry_type(__direntToType(_d_type));
+            if (entry_type == eDirEntryType::UNKNOWN)
+            {
+                struct stat entry_stat;
+                if (fstatat(_dir_fd, _name, &entry_stat, AT_SYMLINK_NOFOLLOW) == 0)
+                    entry_type = stWalkEntry::ModeToType(entry_stat.st_mode);
+            }
+
+            _state.path.resize(_base_length);
+            if (_state.path.empty() || _state.path.back() != '/')
+                _state.path.push_back('/');
+            _state.path.append(_name);
+            const std::size_t entry_length(_state.path.size());
+
+            stWalkEntry walk_entry{.path{_state.path}, .relative{StringView_t(_state.path).substr(_state.relative_offset)}, .name{_name, strlen(_name)}, .parent_fd{_dir_fd}, .inode{_inode}, .type{entry_type}, .depth{_depth}, .post_visit{false}};
+
+            const eWalkAction visit_action(__invokeVisitor(_state.visitor, walk_entry));
+            if (visit_action == eWalkAction::STOP)
+                return false;
+
+            if (entry_type == eDirEntryType::DIRECTORY && _state.options.recursive && visit_action != eWalkAction::SKIP_SUBTREE)
+            {
+                stScopedDescriptor child_descriptor{openat(_dir_fd, _name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)};
+                if (child_descriptor.fd == -1)
+                {
+                    if (!_state.options.skip_errors)
+                        throw std::filesystem::filesystem_error("Cannot open directory", _state.path, std::error_code(errno, std::generic_category()));
+                    if (_state.options.skipped_directories != nullptr)
+                        ++*_state.options.skipped_directories;
+                }
+                else if (!__walkLevel(_state, child_descriptor.fd, _depth + 1))
+                {
+                    return false;
+                }
+
+                if (_state.options.post_order)
+                {
+                    _state.path.resize(entry_length);
+                    walk_entry.path = _state.path;
+                    walk_entry.relative = StringView_t(_state.path).substr(_state.relative_offset);
+                    walk_entry.post_visit = true;
+                    if (__invokeVisitor(_state.visitor, walk_entry) == eWalkAction::STOP)
+                        return false;
+                }
+            }
+            _state.path.resize(_base_length);
+            return true;
+        };
+
+        template <typename _Visitor>
+        static inline const eWalkAction __invokeVisitor(_Visitor &_visitor, const stWalkEntry &_entry)
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<_Visitor &, const stWalkEntry &>>)
+            {
+                _visitor(_entry);
+                return eWalkAction::CONTINUE;
+            }
+            else
+            {
+                return _visitor(_entry);
+            }
+        };
+    };
+
+    /**
+     * @class FSInodeSet
+     * concurrent set of (device, inode) pairs, used to visit hardlinked files once, pairs are
+     * spread over FS_PROFILE_REGISTER_SHARDS independently locked shards.
+     */
+    class FSInodeSet
+    {
+    public:
+        /* returns true if the pair was not in the set yet */
+        inline const bool Insert(const std::uint64_t _device, const std::uint64_t _inode)
+        {
+            const std::size_t inode_hash(std::hash<std::uint64_t>{}(_inode ^ (_device * 0x9E3779B97F4A7C15ULL)));
+            stInodeShard &shard(_shards[inode_hash & (FS_PROFILE_REGISTER_SHARDS - 1)]);
+            std::lock_guard<std::mutex> shard_lock(shard.mtx);
+            return shard.keys.emplace(_device, _inode).second;
+        };
+
+    private:
+        struct stInodeKeyHash
+        {
+            inline std::size_t operator()(const std::pair<std::uint64_t, std::uint64_t> &_key) const noexcept
+            {
+                return std::hash<std::uint64_t>{}(_key.second ^ (_key.first * 0x9E3779B97F4A7C15ULL));
+            };
+        };
+
+        struct stInodeShard
+        {
+            std::mutex mtx;
+            std::unordered_set<std::pair<std::uint64_t, std::uint64_t>, stInodeKeyHash> keys;
+        };
+
+        std::array<stInodeShard, FS_PROFILE_REGISTER_SHARDS> _shards{};
+    };
+
+    /*                Group Commit Scheduler                 *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     * @class FSDirectorySyncError
+     * thrown by durable writes once the new content is renamed into place but the parent directory
+     * could not be synced, the file holds the new content, the rename may not survive a crash.
+     */
+    class FSDirectorySyncError : public std::runtime_error
+    {
+    public:
+        explicit FSDirectorySyncError(const String_t &_message) : std::runtime_error(_message) {};
+    };
+
+    /**
+     * @class FSGroupCommitScheduler
+     * batches durability work of concurrent atomic writers. requests arriving within the commit
+     * window are committed together: writeback of every temp file is started first, the files are
+     * fdatasync'ed in parallel, renamed into place in arrival order, and every distinct parent
+     * directory is fsync'ed once for the whole batch, in parallel as well. parallel syncs run on a
+     * pool owned by the scheduler, the committer thread joins them, FS_GROUP_COMMIT_SYNC_THREADS in
+     * total. Commit() blocks the writer until its batch is durable.
+     */
+    class FSGroupCommitScheduler
+    {
+    public:
+        /* process-wide scheduler shared by every FSController instance */
+        static FSGroupCommitScheduler &Shared(void)
+        {
+            static FSGroupCommitScheduler shared_scheduler;
+            return shared_scheduler;
+        };
+
+        FSGroupCommitScheduler(const FSGroupCommitScheduler &o) = delete;
+        FSGroupCommitScheduler &operator=(const FSGroupCommitScheduler &o) = delete;
+
+        /* latency window during which requests are gathered into one batch */
+        inline void SetCommitWindow(const std::chrono::microseconds _window) noexcept
+        {
+            this->_window_us.store(static_cast<std::size_t>(_window.count()), std::memory_order_relaxed);
+        };
+
+        /**
+         *
+         * make _temp_path(open as _fd, fully written) durable and rename it onto _final_path, then
+         * sync the parent directory, blocks until the batch holding this request is committed.
+         * @param int descriptor of the written temp file, not closed by the scheduler
+         * @param String_t& temp file path
+         * @param String_t& destination path
+         * @returns void
+         *
+         * @throws std::runtime_error If syncing or renaming fails.
+         * @throws FSDirectorySyncError If the file was renamed into place but its parent directory could not be synced.
+         */
+        inline void Commit(const int _fd, const String_t &_temp_path, const String_t &_final_path)
+        {
+            std::future<void> commit_done;
+            {
+                std::lock_guard<std::mutex> _lock(this->_queue_guard);
+                this->_pending.push_back(stCommitRequest{_fd, _temp_path, _final_path, {}});
+                commit_done = this->_pending.back().done.get_future();
+            }
+            this->_queue_cv.notify_one();
+            commit_done.get();
+        };
+
+        inline const std::uint64_t CommittedBatches(void) const noexcept
+        {
+            return this->_batches.load(std::memory_order_relaxed);
+        };
+
+        ~FSGroupCommitScheduler() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> _lock(this->_queue_guard);
+                this->_stopping = true;
+            }
+            this->_queue_cv.notify_all();
+            if (this->_committer.joinable())
+                this->_committer.join();
+        };
+
+    private:
+        struct stCommitRequest
+        {
+            int fd;
+            String_t temp_path;
+            String_t final_path;
+            std::promise<void> done;
+        };
+
+        std::mutex _queue_guard;
+        std::condition_variable _queue_cv;
+        std::vector<stCommitRequest> _pending;
+        std::atomic<std::size_t> _window_us{FS_GROUP_COMMIT_WINDOW_US};
+        std::atomic<std::uint64_t> _batches{0};
+        bool _stopping{false};
+        FSWorkStealingPool _sync_pool{std::max<std::size_t>(FS_GROUP_COMMIT_SYNC_THREADS, 2) - 1};
+        std::thread _committer;
+
+        FSGroupCommitScheduler()
+        {
+            this->_committer = std::thread([this]
+                                           { this->__commitLoop(); });
+        };
+
+        inline void __commitLoop(void)
+        {
+            while (true)
+            {
+                std::vector<stCommitRequest> commit_batch;
+                {
+                    std::unique_lock<std::mutex> _lock(this->_queue_guard);
+                    this->_queue_cv.wait(_lock, [this]
+                                         { return this->_stopping || !this->_pending.empty(); });
+                    if (this->_pending.empty())
+                        return;
+                    const auto batch_deadline(std::chrono::steady_clock::now() + std::chrono::microseconds(this->_window_us.load(std::memory_order_relaxed)));
+                    this->_queue_cv.wait_until(_lock, batch_deadline, [this]
+                                               { return this->_stopping || this->_pending.size() >= FS_GROUP_COMMIT_MAX_BATCH; });
+                    commit_batch.swap(this->_pending);
+                }
+                this->__commitBatch(commit_batch);
+                this->_batches.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+
+        inline void __commitBatch(std::vector<stCommitRequest> &_batch)
+        {
+            std::vector<int> request_errors(_batch.size(), 0);
+#if defined(__linux__)
+            for (const stCommitRequest &request : _batch)
+                sync_file_range(request.fd, 0, 0, SYNC_FILE_RANGE_WRITE); /* start writeback of the whole batch before waiting on any */
+#endif
+            this->__parallelFor(_batch.size(), [&_batch, &request_errors](const std::size_t _r) noexcept
+                                {
+#if defined(__APPLE__)
+                if (fsync(_batch[_r].fd) == -1)
+#else
+                if (fdatasync(_batch[_r].fd) == -1)
+#endif
+                    request_errors[_r] = errno; });
+
+            for (std::size_t r = 0; r < _batch.size(); ++r)
+                if (request_errors[r] == 0 && rename(_batch[r].temp_path.c_str(), _batch[r].final_path.c_str()) == -1)
+                    request_errors[r] = errno;
+
+            std::unordered_map<String_t, int> parent_directories;
+            for (std::size_t r = 0; r < _batch.size(); ++r)
+                if (request_errors[r] == 0)
+                    parent_directories.emplace(std::filesystem::path(_batch[r].final_path).parent_path().string(), 0);
+            std::vector<std::pair<const String_t, int> *> directory_syncs;
+            directory_syncs.reserve(parent_directories.size());
+            for (auto &parent_directory : parent_directories)
+                directory_syncs.push_back(&parent_directory);
+            this->__parallelFor(directory_syncs.size(), [&directory_syncs](const std::size_t _d) noexcept
+                                {
+                auto &[directory, directory_error] = *directory_syncs[_d];
+                const stScopedDescriptor directory_descriptor{open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)};
+                if (directory_descriptor.fd == -1 || fsync(directory_descriptor.fd) == -1)
+                    directory_error = errno; });
+
+            for (std::size_t r = 0; r < _batch.size(); ++r)
+            {
+                if (request_errors[r] != 0)
+                {
+                    _batch[r].done.set_exception(std::make_exception_ptr(std::runtime_error(String_t("Group commit failed for ") + _batch[r].final_path + ": " + strerror(request_errors[r]))));
+                    continue;
+                }
+                const int directory_error(parent_directories[std::filesystem::path(_batch[r].final_path).parent_path().string()]);
+                if (directory_error == 0)
+                    _batch[r].done.set_value();
+                else
+                    _batch[r].done.set_exception(std::make_exception_ptr(FSDirectorySyncError(String_t("Written but parent directory sync failed for ") + _batch[r].final_path + ": " + strerror(directory_error))));
+            }
+        };
+
+        /* run _work(i) for every i below _count on up to FS_GROUP_COMMIT_SYNC_THREADS threads, the committer included */
+        template <typename _Work>
+        inline void __parallelFor(const std::size_t _count, const _Work &_work)
+        {
+            if (_count == 0)
+                return;
+            std::atomic<std::size_t> next_index{0};
+            const auto drain_work = [&_count, &_work, &next_index]() noexcept
+            {
+                for (std::size_t i = next_index.fetch_add(1, std::memory_order_relaxed); i < _count; i = next_index.fetch_add(1, std::memory_order_relaxed))
+                    _work(i);
+            };
+            FSTaskGroup task_group(this->_sync_pool);
+            const std::size_t helper_count(std::min(_count, FS_GROUP_COMMIT_SYNC_THREADS) - 1);
+            for (std::size_t h = 0; h < helper_count; ++h)
+            {
+                try
+                {
+                    task_group.Run(drain_work);
+                }
+                catch (const std::exception &)
+                {
+                    break; /* the committer drains whatever is left */
+                }
+            }
+            drain_work();
+            task_group.Wait();
+        };
+    };
+
+    /*                  Directory Watcher                    *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+#if defined(FS_HAS_INOTIFY)
+
+    enum class eWatchEvent : uint8_t
+    {
+        CREATED = 0, /* file entered the live map */
+        MODIFIED,    /* file content was re-read */
+        DELETED,     /* file left the live map */
+        RESCANNED    /* event queue overflowed, the whole tree was re-profiled */
+    };
+
+    typedef struct alignas(void *)
+    {
+        eWatchEvent event{eWatchEvent::MODIFIED};
+        String_t path{}; /* full path of the file, the watch root for RESCANNED */
+    } stWatchEvent;
+
+    /**
+     * @class FSDirectoryWatcher
+     * keeps a directory profile current through inotify, every directory of the tree is watched and
+     * only files reported as created, written or moved are re-read, deleted or moved out files are
+     * dropped. events read together are coalesced per path before files are read. the live map is
+     * guarded by a mutex, the change callback runs on the watcher thread without the lock held.
+     */
+    class FSDirectoryWatcher
+    {
+    public:
+        using profileReader_t = std::function<bool(const String_t &, struct stFileDescriptor &)>;
+        using watchCallback_t = std::function<void(const stWatchEvent &)>;
+        using liveMap_t = std::unordered_map<String_t, struct stFileDescriptor>;
+
+        /**
+         *
+         * create the inotify instance and watch every directory under _root, events are queued from
+         * here on so a scan performed before Start() cannot miss changes.
+         * @param StringView_t& directory to watch
+         * @param profileReader_t reads a file into a descriptor, false if it cannot be profiled
+         * @param watchCallback_t optional! change callback
+         *
+         * @throws std::runtime_error If inotify cannot be initialized or a watch cannot be added.
+         */
+        FSDirectoryWatcher(const StringView_t &_root, profileReader_t _reader, watchCallback_t _callback = nullptr) : _root_path(_root), _reader(std::move(_reader)), _callback(std::move(_callback))
+        {
+            while (this->_root_path.size() > 1 && this->_root_path.back() == '/')
+                this->_root_path.pop_back();
+            this->_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (this->_inotify_fd == -1)
+                throw std::runtime_error(String_t("inotify_init1 failed: ") + strerror(errno));
+            this->_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (this->_wakeup_fd == -1)
+            {
+                close(this->_inotify_fd);
+                throw std::runtime_error(String_t("eventfd failed: ") + strerror(errno));
+            }
+            try
+            {
+                this->__watchTree(this->_root_path, nullptr);
+            }
+            catch (...)
+            {
+                close(this->_inotify_fd);
+                close(this->_wakeup_fd);
+                throw;
+            }
+        };
+
+        FSDirectoryWatcher(const FSDirectoryWatcher &) = delete;
+        FSDirectoryWatcher &operator=(const FSDirectoryWatcher &) = delete;
+
+        ~FSDirectoryWatcher() noexcept
+        {
+            this->Stop();
+            close(this->_inotify_fd);
+            close(this->_wakeup_fd);
+        };
+
+        /* seed the live map with _initial_profile and start processing events */
+        inline void Start(liveMap_t &&_initial_profile)
+        {
+            {
+                std::lock_guard<std::mutex> _lock(this->_map_guard);
+                this->_live_map = std::move(_initial_profile);
+            }
+            if (!this->_event_thread.joinable())
+                this->_event_thread = std::thread([this]
+                                                  { this->__eventLoop(); });
+        };
+
+        /* stop the watcher thread, the live map stays readable */
+        inline void Stop(void) noexcept
+        {
+            if (!this->_event_thread.joinable())
+                return;
+            this->_stop_requested.store(true, std::memory_order_release);
+            const std::uint64_t wakeup_value(1);
+            [[maybe_unused]] const ssize_t wakeup_state(write(this->_wakeup_fd, &wakeup_value, sizeof(wakeup_value))); /* if it fails the thread sees _stop_requested at its next poll timeout */
+            this->_event_thread.join();
+            this->_stop_requested.store(false, std::memory_order_relaxed);
+        };
+
+        /* copy of the live map */
+        inline const liveMap_t Snapshot(void) const
+        {
+            std::lock_guard<std::mutex> _lock(this->_map_guard);
+            return this->_live_map;
+        };
+
+        /* copy the live profile of _path into _profile, false if it is not in the map */
+        inline const bool GetProfile(const String_t &_path, struct stFileDescriptor &_profile) const
+        {
+            std::lock_guard<std::mutex> _lock(this->_map_guard);
+            const auto live_entry(this->_live_map.find(_path));
+            if (live_entry == this->_live_map.end())
+                return false;
+            _profile = live_entry->second;
+            return true;
+        };
+
+        /* call _visitor(const liveMap_t&) with the live map locked, _visitor must not call back into the watcher */
+        template <typename _Visitor>
+        inline void Visit(_Visitor &&_visitor) const
+        {
+            std::lock_guard<std::mutex> _lock(this->_map_guard);
+            _visitor(static_cast<const liveMap_t &>(this->_live_map));
+        };
+
+        inline const std::size_t Size(void) const
+        {
+            std::lock_guard<std::mutex> _lock(this->_map_guard);
+            return this->_live_map.size();
+        };
+
+        /* number of files re-read since Start() */
+        inline const std::uint64_t Refreshes(void) const noexcept
+        {
+            return this->_refreshes.load(std::memory_order_relaxed);
+        };
+
+    private:
+        static constexpr uint32_t _watch_mask = IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_DELETE_SELF | IN_ONLYDIR | IN_DONT_FOLLOW | IN_EXCL_UNLINK;
+
+        String_t _root_path;
+        profileReader_t _reader;
+        watchCallback_t _callback;
+        int _inotify_fd{-1};
+        int _wakeup_fd{-1};
+        std::thread _event_thread;
+        std::atomic<bool> _stop_requested{false};
+        std::unordered_map<int, String_t> _watch_paths; /* watch descriptor -> directory, watcher thread only after Start() */
+        mutable std::mutex _map_guard;
+        liveMap_t _live_map;
+        std::atomic<std::uint64_t> _refreshes{0};
+
+        /* watch _directory and every directory below it, regular files found are appended to _found_files when given */
+        inline void __watchTree(const String_t &_directory, std::vector<String_t> *_found_files)
+        {
+            this->__addWatch(_directory);
+            FSDirectoryWalker::Walk(_directory, stWalkOptions{.skip_errors = true}, [this, _found_files](const stWalkEntry &dir_entry)
+                                    {
+                const eDirEntryType entry_type(dir_entry.type == eDirEntryType::UNKNOWN ? dir_entry.ResolvedType() : dir_entry.type);
+                if (entry_type == eDirEntryType::DIRECTORY)
+                    this->__addWatch(String_t(dir_entry.path));
+                else if (_found_files != nullptr && (entry_type == eDirEntryType::REGULAR || entry_type == eDirEntryType::SYMLINK))
+                    _found_files->emplace_back(dir_entry.path); });
+        };
+
+        inline void __addWatch(const String_t &_directory)
+        {
+            const int watch_descriptor(inotify_add_watch(this->_inotify_fd, _directory.c_str(), _watch_mask));
+            if (watch_descriptor == -1)
+            {
+                if (errno == ENOENT || errno == ENOTDIR || errno == EACCES)
+                    return;
+                throw std::runtime_error(String_t("inotify_add_watch failed for ") + _directory + ": " + strerror(errno));
+            }
+            this->_watch_paths.insert_or_assign(watch_descriptor, _directory);
+        };
+
+        /* drop watches of _directory and below, inotify may have removed them already */
+        inline void __unwatchTree(const String_t &_directory)
+        {
+            const String_t directory_prefix(_directory + '/');
+            for (auto watched = this->_watch_paths.begin(); watched != this->_watch_paths.end();)
+            {
+                if (watched->second == _directory || watched->second.compare(0, directory_prefix.size(), directory_prefix) == 0)
+                {
+                    inotify_rm_watch(this->_inotify_fd, watched->first);
+                    watched = this->_watch_paths.erase(watched);
+                }
+                else
+                {
+                    ++watched;
+                }
+            }
+        };
+
+        inline void __eventLoop(void)
+        {
+            alignas(struct inotify_event) char event_buffer[FS_WALKER_BUFFER_SIZE];
+            std::array<struct pollfd, 2> poll_fds{pollfd{this->_inotify_fd, POLLIN, 0}, pollfd{this->_wakeup_fd, POLLIN, 0}};
+            for (;;)
+            {
+                const int ready_count(poll(poll_fds.data(), poll_fds.size(), FS_WATCHER_POLL_TIMEOUT_MS));
+                if (ready_count == -1 && errno != EINTR)
+                    return;
+                if (poll_fds[1].revents != 0 || this->_stop_requested.load(std::memory_order_acquire))
+                    return;
+                if (ready_count <= 0)
+                    continue;
+
+                std::map<String_t, bool> pending_paths; /* path -> true to re-read, false to drop, later events win */
+                bool queue_overflow(false);
+                for (;;)
+                {
+                    const ssize_t read_bytes(read(this->_inotify_fd, event_buffer, sizeof(event_buffer)));
+                    if (read_bytes <= 0)
+                        break;
+                    for (const char *event_ptr = event_buffer; event_ptr < event_buffer + read_bytes;)
+                    {
+                        const struct inotify_event *watch_event(reinterpret_cast<const struct inotify_event *>(event_ptr));
+                        event_ptr += sizeof(struct inotify_event) + watch_event->len;
+                        queue_overflow |= (watch_event->mask & IN_Q_OVERFLOW) != 0;
+                        this->__collectEvent(*watch_event, pending_paths);
+                    }
+                }
+
+                if (queue_overflow)
+                    this->__rescan();
+                else
+                    this->__applyPending(pending_paths);
+            }
+        };
+
+        inline void __collectEvent(const struct inotify_event &_event, std::map<String_t, bool> &_pending_paths)
+        {
+            if (_event.mask & IN_IGNORED)
+            {
+                this->_watch_paths.erase(_event.wd);
+                return;
+            }
+            const auto watched(this->_watch_paths.find(_event.wd));
+            if (watched == this->_watch_paths.end() || _event.len == 0)
+                return;
+            const String_t event_path(watched->second + '/' + _event.name);
+
+            if (_event.mask & IN_ISDIR)
+            {
+                if (_event.mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    std::vector<String_t> found_files;
+                    this->__watchTree(event_path, &found_files);
+                    for (String_t &found_file : found_files)
+                        _pending_paths.insert_or_assign(std::move(found_file), true);
+                }
+                else if (_event.mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    this->__unwatchTree(event_path);
+                    const String_t directory_prefix(event_path + '/');
+                    std::lock_guard<std::mutex> _lock(this->_map_guard);
+                    for (const auto &[live_path, live_profile] : this->_live_map)
+                        if (live_path.compare(0, directory_prefix.size(), directory_prefix) == 0)
+                            _pending_paths.insert_or_assign(live_path, false);
+                }
+                return;
+            }
+            _pending_paths.insert_or_assign(event_path, (_event.mask & (IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO)) != 0);
+        };
+
+        /* re-read or drop every pending path, files are read without the map lock */
+        inline void __applyPending(const std::map<String_t, bool> &_pending_paths)
+        {
+            std::vector<stWatchEvent> change_events;
+            for (const auto &[pending_path, refresh] : _pending_paths)
+            {
+                struct stFileDescriptor refreshed_profile;
+                const bool has_profile(refresh && this->_reader(pending_path, refreshed_profile));
+                if (refresh)
+                    this->_refreshes.fetch_add(1, std::memory_order_relaxed);
+
+                std::lock_guard<std::mutex> _lock(this->_map_guard);
+                if (has_profile)
+                {
+                    const bool inserted(this->_live_map.insert_or_assign(pending_path, std::move(refreshed_profile)).second);
+                    change_events.push_back(stWatchEvent{.event = inserted ? eWatchEvent::CREATED : eWatchEvent::MODIFIED, .path{pending_path}});
+                }
+                else if (this->_live_map.erase(pending_path) != 0)
+                {
+                    change_events.push_back(stWatchEvent{.event = eWatchEvent::DELETED, .path{pending_path}});
+                }
+            }
+            if (this->_callback)
+                for (const stWatchEvent &change_event : change_events)
+                    this->_callback(change_event);
+        };
+
+        /* events were lost, watch the tree again and re-read every file */
+        inline void __rescan(void)
+        {
+            this->__unwatchTree(this->_root_path);
+            std::vector<String_t> found_files;
+            this->__watchTree(this->_root_path, &found_files);
+
+            liveMap_t rescanned_map;
+            for (const String_t &found_file : found_files)
+            {
+                struct stFileDescriptor refreshed_profile;
+                if (this->_reader(found_file, refreshed_profile))
+                    rescanned_map.insert_or_assign(found_file, std::move(refreshed_profile));
+            }
+            this->_refreshes.fetch_add(found_files.size(), std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> _lock(this->_map_guard);
+                this->_live_map = std::move(rescanned_map);
+            }
+            if (this->_callback)
+                this->_callback(stWatchEvent{.event = eWatchEvent::RESCANNED, .path{this->_root_path}});
+        };
+    };
+
+#endif
+
+    /*                     Scan Index                        *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     *
+     * on-disk scan index layout(native byte order, a foreign byte order fails the version check):
+     * header | stScanIndexEntry[entry_count] sorted by path | path string table
+     */
+    struct stScanIndexHeader
+    {
+        char magic[8];                /* "FSCINDEX" */
+        std::uint32_t version;        /* FS_SCAN_INDEX_VERSION */
+        std::uint32_t flags;          /* FSScanIndex::HAS_CONTENT_HASH */
+        std::uint64_t entry_count;
+        std::uint64_t entries_offset; /* byte offset of the entry table */
+        std::uint64_t strings_offset; /* byte offset of the path string table */
+        std::uint64_t strings_size;
+        std::uint64_t created_at;     /* index creation time, ns since epoch */
+        std::uint64_t reserved;
+    };
+
+    struct stScanIndexEntry
+    {
+        std::uint64_t path_offset;  /* offset of the full path within the string table */
+        std::uint32_t path_length;
+        std::uint32_t mtime_nsec;
+        std::uint64_t size;         /* apparent size at scan time */
+        std::int64_t mtime_sec;
+        std::uint64_t inode;
+        std::uint64_t device;
+        std::uint64_t content_hash; /* XXH64 of the content, 0 without HAS_CONTENT_HASH */
+        std::uint64_t reserved;
+    };
+
+    static_assert(sizeof(stScanIndexHeader) == 64 && sizeof(stScanIndexEntry) == 64, "scan index records must stay 64 bytes");
+
+    /* file metadata fed to FSScanIndex::Serialize */
+    typedef struct alignas(void *)
+    {
+        String_t path{};
+        std::uint64_t size{0};
+        struct timespec mtime{};
+        std::uint64_t inode{0};
+        std::uint64_t device{0};
+        std::uint64_t content_hash{0};
+    } stScanIndexRecord;
+
+    enum class eIndexEntryState : uint8_t
+    {
+        FRESH = 0, /* size, mtime, inode and device still match */
+        STALE,     /* file changed since the scan */
+        MISSING    /* file no longer exists */
+    };
+
+    /**
+     * @class FSScanIndex
+     * read-only view over a memory mapped scan index, opening only validates the header so the
+     * cost does not depend on the index size, entries are read straight from the mapping. lookups
+     * are binary searches over the sorted entry table, entries are revalidated against the
+     * filesystem only when asked to.
+     */
+    class FSScanIndex
+    {
+    public:
+        static constexpr std::uint32_t HAS_CONTENT_HASH = 1u << 0;
+
+        FSScanIndex() noexcept = default;
+
+        /* adopt _index_view, the index stays empty(Valid() false) if the header does not check out */
+        explicit FSScanIndex(stMappedFileView &&_index_view) noexcept : _index_view(std::move(_index_view))
+        {
+            if (this->_index_view.Size() < sizeof(stScanIndexHeader))
+                return;
+            const char *index_base(this->_index_view.Data());
+            const stScanIndexHeader *index_header(reinterpret_cast<const stScanIndexHeader *>(index_base));
+            const std::uint64_t index_size(this->_index_view.Size());
+            if (std::memcmp(index_header->magic, _magic, sizeof(index_header->magic)) != 0 || index_header->version != FS_SCAN_INDEX_VERSION)
+                return;
+            if (index_header->entries_offset % alignof(stScanIndexEntry) != 0 || index_header->entries_offset > index_size ||
+                index_header->entry_count > (index_size - index_header->entries_offset) / sizeof(stScanIndexEntry))
+                return;
+            if (index_header->strings_offset > index_size || index_header->strings_size > index_size - index_header->strings_offset)
+                return;
+            this->_header = index_header;
+            this->_entries = reinterpret_cast<const stScanIndexEntry *>(index_base + index_header->entries_offset);
+            this->_strings = index_base + index_header->strings_offset;
+        };
+
+        FSScanIndex(const FSScanIndex &) = delete;
+        FSScanIndex &operator=(const FSScanIndex &) = delete;
+
+        /* the mapping moves with the index, table pointers stay valid */
+        FSScanIndex(FSScanIndex &&o) noexcept : _index_view(std::move(o._index_view)), _header(std::exchange(o._header, nullptr)), _entries(std::exchange(o._entries, nullptr)), _strings(std::exchange(o._strings, nullptr)) {};
+
+        FSScanIndex &operator=(FSScanIndex &&o) noexcept
+        {
+            if (this != &o)
+            {
+                this->_index_view = std::move(o._index_view);
+                this->_header = std::exchange(o._header, nullptr);
+                this->_entries = std::exchange(o._entries, nullptr);
+                this->_strings = std::exchange(o._strings, nullptr);
+            }
+            return *this;
+        };
+
+        inline const bool Valid(void) const noexcept { return this->_header != nullptr; };
+        inline const std::size_t Size(void) const noexcept { return this->_header ? static_cast<std::size_t>(this->_header->entry_count) : 0; };
+        inline const bool HasContentHashes(void) const noexcept { return this->_header && (this->_header->flags & HAS_CONTENT_HASH); };
+        inline const std::uint64_t CreatedAt(void) const noexcept { return this->_header ? this->_header->created_at : 0; };
+
+        inline const stScanIndexEntry *begin(void) const noexcept { return this->_entries; };
+        inline const stScanIndexEntry *end(void) const noexcept { return this->_entries + this->Size(); };
+
+        /* full path of _entry, empty if its string reference is out of bounds */
+        inline const StringView_t Path(const stScanIndexEntry &_entry) const noexcept
+        {
+            if (_entry.path_offset > this->_header->strings_size || _entry.path_length > this->_header->strings_size - _entry.path_offset)
+                return StringView_t();
+            return StringView_t(this->_strings + _entry.path_offset, _entry.path_length);
+        };
+
+        /* entry recorded for _path, nullptr if the index does not know it */
+        inline const stScanIndexEntry *Find(const StringView_t &_path) const noexcept
+        {
+            const stScanIndexEntry *found_entry(std::lower_bound(this->begin(), this->end(), _path, [this](const stScanIndexEntry &_entry, const StringView_t &_key)
+                                                                 { return this->Path(_entry) < _key; }));
+            return found_entry != this->end() && this->Path(*found_entry) == _path ? found_entry : nullptr;
+        };
+
+        /* entries whose path starts with _prefix, e.g. every file below "dir/" */
+        inline const std::pair<const stScanIndexEntry *, const stScanIndexEntry *> PrefixRange(const StringView_t &_prefix) const noexcept
+        {
+            const stScanIndexEntry *range_begin(std::lower_bound(this->begin(), this->end(), _prefix, [this](const stScanIndexEntry &_entry, const StringView_t &_key)
+                                                                 { return this->Path(_entry) < _key; }));
+            const stScanIndexEntry *range_end(std::partition_point(range_begin, this->end(), [this, &_prefix](const stScanIndexEntry &_entry)
+                                                                    { return this->Path(_entry).compare(0, _prefix.size(), _prefix) == 0; }));
+            return {range_begin, range_end};
+        };
+
+        /* compare _entry against the file on disk, a single stat */
+        inline const eIndexEntryState Revalidate(const stScanIndexEntry &_entry) const noexcept
+        {
+            struct stat file_stat;
+            if (stat(String_t(this->Path(_entry)).c_str(), &file_stat) == -1)
+                return eIndexEntryState::MISSING;
+#if defined(__APPLE__)
+            const struct timespec file_mtime(file_stat.st_mtimespec);
+#else
+            const struct timespec file_mtime(file_stat.st_mtim);
+#endif
+            const bool unchanged(static_cast<std::uint64_t>(file_stat.st_size) == _entry.size && static_cast<std::uint64_t>(file_stat.st_ino) == _entry.inode &&
+                                 static_cast<std::uint64_t>(file_stat.st_dev) == _entry.device && static_cast<std::int64_t>(file_mtime.tv_sec) == _entry.mtime_sec && static_cast<std::uint32_t>(file_mtime.tv_nsec) == _entry.mtime_nsec);
+            return unchanged ? eIndexEntryState::FRESH : eIndexEntryState::STALE;
+        };
+
+        /**
+         *
+         * encode _records into the on-disk index format, _records are sorted by path in place.
+         * @param std::vector<stScanIndexRecord>& the files to index
+         * @param bool true if the records carry content hashes
+         * @returns String_t the index bytes
+         */
+        static String_t Serialize(std::vector<stScanIndexRecord> &_records, const bool _content_hashes)
+        {
+            std::sort(_records.begin(), _records.end(), [](const stScanIndexRecord &_a, const stScanIndexRecord &_b)
+                      { return _a.path < _b.path; });
+
+            std::size_t strings_size(0);
+            for (const stScanIndexRecord &index_record : _records)
+                strings_size += index_record.path.size();
+
+            String_t index_bytes(sizeof(stScanIndexHeader) + _records.size() * sizeof(stScanIndexEntry) + strings_size, '\0');
+            stScanIndexHeader index_header{};
+            std::memcpy(index_header.magic, _magic, sizeof(index_header.magic));
+            index_header.version = FS_SCAN_INDEX_VERSION;
+            index_header.flags = _content_hashes ? HAS_CONTENT_HASH : 0;
+            index_header.entry_count = _records.size();
+            index_header.entries_offset = sizeof(stScanIndexHeader);
+            index_header.strings_offset = sizeof(stScanIndexHeader) + _records.size() * sizeof(stScanIndexEntry);
+            index_header.strings_size = strings_size;
+            index_header.created_at = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+            std::memcpy(index_bytes.data(), &index_header, sizeof(index_header));
+
+            std::size_t entry_offset(index_header.entries_offset), path_offset(0);
+            for (const stScanIndexRecord &index_record : _records)
+            {
+                const stScanIndexEntry index_entry{.path_offset = path_offset,
+                                                   .path_length = static_cast<std::uint32_t>(index_record.path.size()),
+                                                   .mtime_nsec = static_cast<std::uint32_t>(index_record.mtime.tv_nsec),
+                                                   .size = index_record.size,
+                                                   .mtime_sec = static_cast<std::int64_t>(index_record.mtime.tv_sec),
+                                                   .inode = index_record.inode,
+                                                   .device = index_record.device,
+                                                   .content_hash = _content_hashes ? index_record.content_hash : 0,
+                                                   .reserved = 0};
+                std::memcpy(index_bytes.data() + entry_offset, &index_entry, sizeof(index_entry));
+                std::memcpy(index_bytes.data() + index_header.strings_offset + path_offset, index_record.path.data(), index_record.path.size());
+                entry_offset += sizeof(stScanIndexEntry);
+                path_offset += index_record.path.size();
+            }
+            return index_bytes;
+        };
+
+    private:
+        static constexpr char _magic[8] = {'F', 'S', 'C', 'I', 'N', 'D', 'E', 'X'};
+
+        stMappedFileView _index_view{};
+        const stScanIndexHeader *_header{nullptr};
+        const stScanIndexEntry *_entries{nullptr};
+        const char *_strings{nullptr};
+    };
+
+    /*                     Path Table                        *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     * @class FSPathTable
+     * compact append-only table of file paths. every directory string is stored once, a file entry
+     * is {directory index, name} with both strings living in an arena of large chunks, so a path
+     * costs its name bytes plus 16 bytes instead of a heap allocated String_t holding the full path.
+     * chunks never move, views handed out stay valid as long as the table lives. move-only.
+     */
+    class FSPathTable
+    {
+    public:
+        /* a path split into its directory and name, Path() joins them */
+        struct stPathView
+        {
+            StringView_t directory{};
+            StringView_t name{};
+
+            inline const bool HasSeparator(void) const noexcept { return !directory.empty() && directory.back() != '/'; };
+            inline const std::size_t Length(void) const noexcept { return directory.size() + (HasSeparator() ? 1 : 0) + name.size(); };
+
+            inline void AppendTo(String_t &_destination) const
+            {
+                _destination.append(directory);
+                if (HasSeparator())
+                    _destination.push_back('/');
+                _destination.append(name);
+            };
+
+            inline const String_t Path(void) const
+            {
+                String_t full_path;
+                full_path.reserve(Length());
+                AppendTo(full_path);
+                return full_path;
+            };
+
+            /* lexicographic order of the joined paths, without joining them */
+            inline const int Compare(const stPathView &_other) const noexcept
+            {
+                if (directory == _other.directory)
+                    return name.compare(_other.name);
+                const std::size_t lhs_length(Length()), rhs_length(_other.Length());
+                const std::size_t common_length(std::min(lhs_length, rhs_length));
+                for (std::size_t c = 0; c < common_length; ++c)
+                {
+                    const unsigned char lhs_char(At(c)), rhs_char(_other.At(c));
+                    if (lhs_char != rhs_char)
+                        return lhs_char < rhs_char ? -1 : 1;
+                }
+                return lhs_length == rhs_length ? 0 : (lhs_length < rhs_length ? -1 : 1);
+            };
+
+            inline const char At(const std::size_t _index) const noexcept
+            {
+                if (_index < directory.size())
+                    return directory[_index];
+                const std::size_t separator_length(HasSeparator() ? 1 : 0);
+                if (_index < directory.size() + separator_length)
+                    return '/';
+                return name[_index - directory.size() - separator_length];
+            };
+        };
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = stPathView;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = stPathView;
+
+            iterator(const FSPathTable *_table, const std::size_t _index) noexcept : _table(_table), _index(_index) {};
+
+            inline stPathView operator*() const noexcept { return (*_table)[_index]; };
+            inline iterator &operator++() noexcept { ++_index; return *this; };
+            inline iterator operator++(int) noexcept { iterator previous(*this); ++_index; return previous; };
+            inline bool operator==(const iterator &_other) const noexcept { return _index == _other._index; };
+            inline bool operator!=(const iterator &_other) const noexcept { return _index != _other._index; };
+
+        private:
+            const FSPathTable *_table;
+            std::size_t _index;
+        };
+
+        FSPathTable() noexcept = default;
+        FSPathTable(const FSPathTable &o) = delete;
+        FSPathTable &operator=(const FSPathTable &o) = delete;
+        FSPathTable(FSPathTable &&o) noexcept = default;
+        FSPathTable &operator=(FSPathTable &&o) noexcept = default;
+
+        inline const std::size_t Size(void) const noexcept { return _entries.size(); };
+        inline const bool Empty(void) const noexcept { return _entries.empty(); };
+        inline const std::size_t DirectoryCount(void) const noexcept { return _directories.size(); };
+        inline const std::size_t size(void) const noexcept { return _entries.size(); };
+        inline const bool empty(void) const noexcept { return _entries.empty(); };
+        inline iterator begin(void) const noexcept { return iterator(this, 0); };
+        inline iterator end(void) const noexcept { return iterator(this, _entries.size()); };
+
+        inline stPathView operator[](const std::size_t _index) const noexcept
+        {
+            const stPathEntry &path_entry(_entries[_index]);
+            const stPathDirectory &path_directory(_directories[path_entry.directory_index]);
+            return stPathView{.directory{path_directory.data, path_directory.length}, .name{path_entry.name, path_entry.name_length}};
+        };
+
+        inline void Reserve(const std::size_t _entry_count) { _entries.reserve(_entry_count); };
+
+        /* intern _directory, returns its index, consecutive calls with the same directory are O(1) */
+        inline const std::uint32_t AddDirectory(const StringView_t &_directory)
+        {
+            if (!_directories.empty() && _last_directory == _directory)
+                return _last_directory_index;
+            auto directory_entry(_directory_index.find(_directory));
+            if (directory_entry == _directory_index.end())
+            {
+                if (_directories.size() >= std::numeric_limits<std::uint32_t>::max()) [[unlikely]]
+                    throw std::length_error("FSPathTable directory count exceeded");
+                const char *directory_data(__intern(_directory));
+                _directories.push_back(stPathDirectory{.data = directory_data, .length = _directory.size()});
+                directory_entry = _directory_index.emplace(StringView_t(directory_data, _directory.size()), static_cast<std::uint32_t>(_directories.size() - 1)).first;
+            }
+            _last_directory = directory_entry->first;
+            _last_directory_index = directory_entry->second;
+            return _last_directory_index;
+        };
+
+        /* append _name under the directory returned by AddDirectory() */
+        inline void Add(const std::uint32_t _directory_index, const StringView_t &_name)
+        {
+            if (_name.size() > std::numeric_limits<std::uint32_t>::max()) [[unlikely]]
+                throw std::length_error("FSPathTable name too long");
+            _entries.push_back(stPathEntry{.name = __intern(_name), .directory_index = _directory_index, .name_length = static_cast<std::uint32_t>(_name.size())});
+        };
+
+        /* append a full path, split at its last separator */
+        inline void Add(const StringView_t &_path)
+        {
+            const std::size_t separator(_path.rfind('/'));
+            if (separator == StringView_t::npos)
+                Add(AddDirectory(StringView_t()), _path);
+            else
+                Add(AddDirectory(_path.substr(0, separator == 0 ? 1 : separator)), _path.substr(separator + 1));
+        };
+
+        /* copy every entry of _other into this table, directories shared by both are stored once */
+        inline void Append(const FSPathTable &_other)
+        {
+            std::vector<std::uint32_t> directory_remap(_other._directories.size());
+            for (std::size_t d = 0; d < _other._directories.size(); ++d)
+                directory_remap[d] = AddDirectory(StringView_t(_other._directories[d].data, _other._directories[d].length));
+            _entries.reserve(_entries.size() + _other._entries.size());
+            for (const stPathEntry &path_entry : _other._entries)
+                Add(directory_remap[path_entry.directory_index], StringView_t(path_entry.name, path_entry.name_length));
+        };
+
+        /* sort entries by full path, strings are not moved */
+        inline void Sort(void)
+        {
+            std::sort(_entries.begin(), _entries.end(), [this](const stPathEntry &_lhs, const stPathEntry &_rhs)
+                      { return __view(_lhs).Compare(__view(_rhs)) < 0; });
+        };
+
+        /* full paths as individual strings, for callers expecting the vector form */
+        inline const std::vector<String_t> ToVector(void) const
+        {
+            std::vector<String_t> path_vector;
+            path_vector.reserve(_entries.size());
+            for (const stPathView path_view : *this)
+                path_vector.push_back(path_view.Path());
+            return path_vector;
+        };
+
+        /* bytes held by the table: arena chunks, entry and directory arrays, directory index */
+        inline const std::size_t MemoryUsage(void) const noexcept
+        {
+            std::size_t memory_usage(_entries.capacity() * sizeof(stPathEntry) + _directories.capacity() * sizeof(stPathDirectory));
+            for (const stArenaChunk &arena_chunk : _chunks)
+                memory_usage += arena_chunk.capacity;
+            return memory_usage + _directory_index.size() * (sizeof(StringView_t) + sizeof(std::uint32_t) + 2 * sizeof(void *)) + _directory_index.bucket_count() * sizeof(void *);
+        };
+
+        inline void Clear(void) noexcept
+        {
+            _entries.clear();
+            _directories.clear();
+            _directory_index.clear();
+            _chunks.clear();
+            _last_directory = {};
+            _last_directory_index = 0;
+        };
+
+    private:
+        struct stPathEntry
+        {
+            const char *name;
+            std::uint32_t directory_index;
+            std::uint32_t name_length;
+        };
+
+        struct stPathDirectory
+        {
+            const char *data;
+            std::size_t length;
+        };
+
+        struct stArenaChunk
+        {
+            std::unique_ptr<char[]> data;
+            std::size_t capacity;
+            std::size_t used;
+        };
+
+        std::vector<stPathEntry> _entries{};
+        std::vector<stPathDirectory> _directories{};
+        std::unordered_map<StringView_t, std::uint32_t> _directory_index{};
+        std::vector<stArenaChunk> _chunks{};
+        StringView_t _last_directory{};
+        std::uint32_t _last_directory_index{0};
+
+        inline stPathView __view(const stPathEntry &_entry) const noexcept
+        {
+            const stPathDirectory &path_directory(_directories[_entry.directory_index]);
+            return stPathView{.directory{path_directory.data, path_directory.length}, .name{_entry.name, _entry.name_length}};
+        };
+
+        /* copy _bytes into the arena, chunks grow geometrically up to FS_PATH_TABLE_CHUNK_SIZE */
+        inline const char *__intern(const StringView_t &_bytes)
+        {
+            if (_bytes.empty())
+                return "";
+            if (_chunks.empty() || _chunks.back().capacity - _chunks.back().used < _bytes.size())
+            {
+                const std::size_t chunk_capacity(std::max(_bytes.size(), _chunks.empty() ? std::size_t(256) : std::min(_chunks.back().capacity * 2, FS_PATH_TABLE_CHUNK_SIZE)));
+                _chunks.push_back(stArenaChunk{.data = std::make_unique<char[]>(chunk_capacity), .capacity = chunk_capacity, .used = 0});
+            }
+            stArenaChunk &arena_chunk(_chunks.back());
+            char *interned(arena_chunk.data.get() + arena_chunk.used);
+            std::memcpy(interned, _bytes.data(), _bytes.size());
+            arena_chunk.used += _bytes.size();
+            return interned;
+        };
+    };
+
+    /*                     Name Matcher                      *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     * @class FSNameMatcher
+     * compiled multi-pattern file name matcher. literal patterns match anywhere within the name and
+     * are compiled together into a single Aho-Corasick automaton(full transition table, one lookup
+     * per name byte whatever the number of patterns). patterns holding glob characters(* ? [...])
+     * must match the whole name and are compiled into token programs.
+     */
+    class FSNameMatcher
+    {
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        FSNameMatcher() = default;
+
+        explicit FSNameMatcher(const std::vector<String_t> &_patterns)
+        {
+            this->_transitions.emplace_back();
+            this->_transitions.back().fill(0);
+            this->_state_match.push_back(npos);
+            for (std::size_t pattern_index = 0; pattern_index < _patterns.size(); ++pattern_index)
+            {
+                const String_t &pattern(_patterns[pattern_index]);
+                if (pattern.empty())
+                    continue;
+                if (pattern.find_first_of("*?[\\") != String_t::npos)
+                    this->_globs.emplace_back(pattern_index, __compileGlob(pattern));
+                else
+                    this->__addLiteral(pattern, pattern_index);
+                ++this->_pattern_count;
+            }
+            this->__buildAutomaton();
+        };
+
+        inline const bool Empty(void) const noexcept { return this->_pattern_count == 0; };
+        inline const std::size_t Size(void) const noexcept { return this->_pattern_count; };
+
+        /* lowest index of the patterns matching _name, npos if none does */
+        inline const std::size_t Match(const StringView_t &_name) const noexcept
+        {
+            std::size_t matched_index(npos);
+            if (this->_transitions.size() > 1)
+            {
+                std::uint32_t state(0);
+                for (const char name_char : _name)
+                {
+                    state = this->_transitions[state][static_cast<unsigned char>(name_char)];
+                    matched_index = std::min(matched_index, this->_state_match[state]);
+                }
+            }
+            for (const auto &[pattern_index, glob_program] : this->_globs)
+            {
+                if (pattern_index >= matched_index)
+                    break;
+                if (__matchGlob(glob_program, _name))
+                    matched_index = pattern_index;
+            }
+            return matched_index;
+        };
+
+    private:
+        enum class eGlobToken : uint8_t
+        {
+            LITERAL = 0,
+            ANY_CHAR,
+            ANY_SEQUENCE,
+            CHAR_CLASS
+        };
+
+        struct stGlobToken
+        {
+            eGlobToken kind{eGlobToken::LITERAL};
+            unsigned char literal{0};
+            std::bitset<256> char_class{};
+        };
+
+        std::vector<std::array<std::uint32_t, 256>> _transitions; /* state -> next state per byte */
+        std::vector<std::size_t> _state_match;                    /* state -> lowest pattern ending here(suffixes included) */
+        std::vector<std::pair<std::size_t, std::vector<stGlobToken>>> _globs;
+        std::size_t _pattern_count{0};
+
+        inline void __addLiteral(const String_t &_pattern, const std::size_t _pattern_index)
+        {
+            std::uint32_t state(0);
+            for (const char pattern_char : _pattern)
+            {
+                std::uint32_t &next_state(this->_transitions[state][static_cast<unsigned char>(pattern_char)]);
+                if (next_state == 0)
+                {
+                    next_state = static_cast<std::uint32_t>(this->_transitions.size());
+                    this->_transitions.emplace_back();
+                    this->_transitions.back().fill(0);
+                    this->_state_match.push_back(npos);
+                }
+                state = this->_transitions[state][static_cast<unsigned char>(pattern_char)];
+            }
+            this->_state_match[state] = std::min(this->_state_match[state], _pattern_index);
+        };
+
+        /* turn the trie into a DFA, breadth first so failure states are complete before use */
+        inline void __buildAutomaton(void)
+        {
+            std::vector<std::uint32_t> failure_state(this->_transitions.size(), 0);
+            std::deque<std::uint32_t> pending_states;
+            for (std::size_t symbol = 0; symbol < 256; ++symbol)
+                if (this->_transitions[0][symbol] != 0)
+                    pending_states.push_back(this->_transitions[0][symbol]);
+            while (!pending_states.empty())
+            {
+                const std::uint32_t state(pending_states.front());
+                pending_states.pop_front();
+                this->_state_match[state] = std::min(this->_state_match[state], this->_state_match[failure_state[state]]);
+                for (std::size_t symbol = 0; symbol < 256; ++symbol)
+                {
+                    std::uint32_t &next_state(this->_transitions[state][symbol]);
+                    const std::uint32_t fallback_state(this->_transitions[failure_state[state]][symbol]);
+                    if (next_state == 0)
+                    {
+                        next_state = fallback_state;
+                        continue;
+                    }
+                    failure_state[next_state] = fallback_state;
+                    pending_states.push_back(next_state);
+                }
+            }
+        };
+
+        static inline const std::vector<stGlobToken> __compileGlob(const String_t &_pattern)
+        {
+            std::vector<stGlobToken> glob_program;
+            for (std::size_t i = 0; i < _pattern.size(); ++i)
+            {
+                stGlobToken glob_token;
+                if (_pattern[i] == '*')
+                {
+                    glob_token.kind = eGlobToken::ANY_SEQUENCE;
+                    if (!glob_program.empty() && glob_program.back().kind == eGlobToken::ANY_SEQUENCE)
+                        continue;
+                }
+                else if (_pattern[i] == '?')
+                {
+                    glob_token.kind = eGlobToken::ANY_CHAR;
+                }
+                else if (_pattern[i] == '[' && _pattern.find(']', i + 2) != String_t::npos)
+                {
+                    std::size_t class_pos(i + 1);
+                    const bool negated(_pattern[class_pos] == '!' || _pattern[class_pos] == '^');
+                    class_pos += negated ? 1 : 0;
+                    glob_token.kind = eGlobToken::CHAR_CLASS;
+                    for (bool first_char = true; class_pos < _pattern.size() && (first_char || _pattern[class_pos] != ']'); first_char = false)
+                    {
+                        const unsigned char range_begin(static_cast<unsigned char>(_pattern[class_pos]));
+                        if (class_pos + 2 < _pattern.size() && _pattern[class_pos + 1] == '-' && _pattern[class_pos + 2] != ']')
+                        {
+                            for (unsigned int c = range_begin; c <= static_cast<unsigned char>(_pattern[class_pos + 2]); ++c)
+                                glob_token.char_class.set(c);
+                            class_pos += 3;
+                        }
+                        else
+                        {
+                            glob_token.char_class.set(range_begin);
+                            ++class_pos;
+                        }
+                    }
+                    if (negated)
+                        glob_token.char_class.flip();
+                    i = class_pos;
+                }
+                else
+                {
+                    if (_pattern[i] == '\\' && i + 1 < _pattern.size())
+                        ++i;
+                    glob_token.literal = static_cast<unsigned char>(_pattern[i]);
+                }
+                glob_program.push_back(glob_token);
+            }
+            return glob_program;
+        };
+
+        /* whole name match, backtracks to the last '*' only */
+        static inline const bool __matchGlob(const std::vector<stGlobToken> &_program, const StringView_t &_name) noexcept
+        {
+            std::size_t token_pos(0), name_pos(0), star_token(npos), star_name(0);
+            while (name_pos < _name.size())
+            {
+                const unsigned char name_char(static_cast<unsigned char>(_name[name_pos]));
+                if (token_pos < _program.size() && _program[token_pos].kind == eGlobToken::ANY_SEQUENCE)
+                {
+                    star_token = token_pos++;
+                    star_name = name_pos;
+                }
+                else if (token_pos < _program.size() && (_program[token_pos].kind == eGlobToken::ANY_CHAR ||
+                                                         (_program[token_pos].kind == eGlobToken::LITERAL && _program[token_pos].literal == name_char) ||
+                                                         (_program[token_pos].kind == eGlobToken::CHAR_CLASS && _program[token_pos].char_class.test(name_char))))
+                {
+                    ++token_pos;
+                    ++name_pos;
+                }
+                else if (star_token != npos)
+                {
+                    token_pos = star_token + 1;
+                    name_pos = ++star_name;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            while (token_pos < _program.size() && _program[token_pos].kind == eGlobToken::ANY_SEQUENCE)
+                ++token_pos;
+            return token_pos == _program.size();
+        };
+    };
+
+    /*                     Read Planner                      *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    enum class eReadOrder : uint8_t
+    {
+        SUBMISSION = 0, /* keep the caller's order */
+        INODE,          /* device, then inode number, close to on-disk order for most filesystems */
+        PHYSICAL        /* device, then physical offset of the first extent(FIEMAP), inode order for unmapped files */
+    };
+
+    /**
+     * @class FSReadPlanner
+     * orders a batch of file reads by physical layout and hints the next planned files to the page
+     * cache while the current one is read, random I/O on a cold cache becomes mostly sequential. the
+     * planner references _paths, which must outlive it, it holds no mutable state so Advance() may be
+     * called concurrently.
+     */
+    class FSReadPlanner
+    {
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        /**
+         *
+         * plan _paths, batches smaller than FS_READ_PLAN_MIN_BATCH keep submission order. _inodes
+         * optionally provides the inode of every path(0 = unknown, e.g. from stWalkEntry::inode),
+         * INODE ordering then needs no stat. with _directory_fd, every path lives in that directory
+         * and files are opened relative to it, not owned by the planner.
+         * @param std::vector<String_t>& the batch to read
+         * @param eReadOrder optional! ordering key
+         * @param std::size_t optional! files hinted ahead of the current read, 0 disables hints
+         * @param std::vector<std::uint64_t>* optional! inode per path
+         * @param int optional! descriptor of the directory holding every path
+         */
+        explicit FSReadPlanner(const std::vector<String_t> &_paths, const eReadOrder _order = static_cast<eReadOrder>(FS_READ_PLAN_ORDER), const std::size_t _lookahead = FS_READ_PLAN_LOOKAHEAD, const std::vector<std::uint64_t> *_inodes = nullptr, const int _directory_fd = -1)
+            : _paths(_paths), _lookahead(_lookahead), _directory_fd(_directory_fd)
+        {
+            this->_entries.reserve(_paths.size());
+            for (std::size_t p = 0; p < _paths.size(); ++p)
+                this->_entries.push_back(stPlanEntry{.index = p, .inode = _inodes != nullptr && p < _inodes->size() ? (*_inodes)[p] : 0});
+            if (_order == eReadOrder::SUBMISSION || _paths.size() < std::max<std::size_t>(FS_READ_PLAN_MIN_BATCH, 2))
+                return;
+            for (stPlanEntry &entry : this->_entries)
+                this->__resolveKey(_order, entry);
+            std::stable_sort(this->_entries.begin(), this->_entries.end(), [](const stPlanEntry &_a, const stPlanEntry &_b)
+                             { return _a.device != _b.device ? _a.device < _b.device : _a.key < _b.key; });
+        };
+
+        FSReadPlanner(const FSReadPlanner &o) = delete;
+        FSReadPlanner &operator=(const FSReadPlanner &o) = delete;
+
+        inline const std::size_t Size(void) const noexcept { return this->_entries.size(); };
+
+        /* path at planned position _position */
+        inline const String_t &operator[](const std::size_t _position) const noexcept { return this->_paths[this->_entries[_position].index]; };
+
+        /**
+         *
+         * position _position is about to be read, hint the planned files entering the lookahead
+         * window. the window starts at _range_begin and ends at _range_end, a reader walking a range
+         * in order gets every position after the first hinted exactly once.
+         * @param std::size_t planned position being read
+         * @param std::size_t optional! first position of the range read by the caller
+         * @param std::size_t optional! end of that range, npos for the whole plan
+         * @returns void
+         */
+        inline void Advance(const std::size_t _position, const std::size_t _range_begin = 0, const std::size_t _range_end = npos) const noexcept
+        {
+            if (this->_lookahead == 0)
+                return;
+            const std::size_t hint_end(std::min({this->_entries.size(), _range_end, _position + 1 + this->_lookahead}));
+            for (std::size_t h = _position == _range_begin ? _position + 1 : _position + this->_lookahead; h < hint_end; ++h)
+                this->__willNeed((*this)[h]);
+        };
+
+    private:
+        struct stPlanEntry
+        {
+            std::size_t index{0};
+            std::uint64_t inode{0};
+            std::uint64_t device{0};
+            std::uint64_t key{0};
+        };
+
+        const std::vector<String_t> &_paths;
+        const std::size_t _lookahead;
+        const int _directory_fd;
+        std::vector<stPlanEntry> _entries;
+
+        /* name of _path for the *at calls, relative to _directory_fd when given */
+        inline const char *__atName(const String_t &_path) const noexcept
+        {
+            return this->_directory_fd == -1 ? _path.c_str() : _path.c_str() + (_path.rfind('/') + 1);
+        };
+
+        inline const int __atDirectory(void) const noexcept
+        {
+            return this->_directory_fd == -1 ? AT_FDCWD : this->_directory_fd;
+        };
+
+        /* fill device and ordering key, unresolvable files keep key 0 and sort first */
+        inline void __resolveKey(const eReadOrder _order, stPlanEntry &_entry) const noexcept
+        {
+            const String_t &entry_path(this->_paths[_entry.index]);
+            if (_order == eReadOrder::INODE)
+            {
+                struct stat file_stat;
+                if (_entry.inode != 0)
+                    _entry.key = _entry.inode; /* paths of one walk share the walked device */
+                else if (fstatat(this->__atDirectory(), this->__atName(entry_path), &file_stat, 0) == 0)
+                {
+                    _entry.device = static_cast<std::uint64_t>(file_stat.st_dev);
+                    _entry.key = static_cast<std::uint64_t>(file_stat.st_ino);
+                }
+                return;
+            }
+            /* PHYSICAL, the extent map needs the file open, fstat comes with it */
+            const stScopedDescriptor file_descriptor{openat(this->__atDirectory(), this->__atName(entry_path), O_RDONLY | O_CLOEXEC | O_NONBLOCK)};
+            struct stat file_stat;
+            if (file_descriptor.fd == -1 || fstat(file_descriptor.fd, &file_stat) == -1)
+                return;
+            _entry.device = static_cast<std::uint64_t>(file_stat.st_dev);
+            _entry.key = static_cast<std::uint64_t>(file_stat.st_ino);
+#if defined(__linux__) && defined(FS_IOC_FIEMAP)
+            if (!S_ISREG(file_stat.st_mode) || file_stat.st_size == 0)
+                return;
+            alignas(struct fiemap) unsigned char map_buffer[sizeof(struct fiemap) + sizeof(struct fiemap_extent)]{}; /* header + first extent */
+            struct fiemap *extent_map(reinterpret_cast<struct fiemap *>(map_buffer));
+            extent_map->fm_length = FIEMAP_MAX_OFFSET;
+            extent_map->fm_extent_count = 1;
+            /* unmapped files(inline data, delayed allocation) keep their inode as key */
+            if (ioctl(file_descriptor.fd, FS_IOC_FIEMAP, extent_map) == 0 && extent_map->fm_mapped_extents > 0 && !(extent_map->fm_extents[0].fe_flags & FIEMAP_EXTENT_UNKNOWN))
+                _entry.key = extent_map->fm_extents[0].fe_physical;
+#endif
+        };
+
+        /* start asynchronous readahead of the first FS_READ_PLAN_WINDOW bytes of _path */
+        inline void __willNeed(const String_t &_path) const noexcept
+        {
+#if defined(__linux__)
+            const stScopedDescriptor file_descriptor{openat(this->__atDirectory(), this->__atName(_path), O_RDONLY | O_CLOEXEC | O_NONBLOCK)};
+            if (file_descriptor.fd != -1)
+                posix_fadvise(file_descriptor.fd, 0, static_cast<off_t>(FS_READ_PLAN_WINDOW), POSIX_FADV_WILLNEED);
+#endif
+        };
+    };
+
+    /*                    io_uring Engine                    *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+#if defined(FS_HAS_IO_URING)
+    /**
+     * @class FSUringEngine
+     * minimal raw io_uring ring(no liburing dependency), maps submission/completion rings and
+     * exposes sqe acquisition, submit/wait and completion reaping. Ready() is false when the
+     * kernel refuses the ring or lacks one of the operations requested at construction.
+     */
+    class FSUringEngine
+    {
+    public:
+        explicit FSUringEngine(const unsigned _entries, const std::initializer_list<std::uint8_t> _required_ops = {}) noexcept
+        {
+            struct io_uring_params ring_params;
+            memset(&ring_params, 0, sizeof(ring_params));
+            this->_ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, _entries, &ring_params));
+            if (this->_ring_fd < 0)
+                return;
+
+            this->_sq_ring_size = ring_params.sq_off.array + ring_params.sq_entries * sizeof(unsigned);
+            this->_cq_ring_size = ring_params.cq_off.cqes + ring_params.cq_entries * sizeof(struct io_uring_cqe);
+            const bool single_mmap((ring_params.features & IORING_FEAT_SINGLE_MMAP) != 0);
+            if (single_mmap)
+                this->_sq_ring_size = this->_cq_ring_size = std::max(this->_sq_ring_size, this->_cq_ring_size);
+
+            this->_sq_ring = static_cast<char *>(mmap(nullptr, this->_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->_ring_fd, IORING_OFF_SQ_RING));
+            if (this->_sq_ring == MAP_FAILED)
+            {
+                this->_sq_ring = nullptr;
+                return;
+            }
+            this->_cq_ring = single_mmap ? this->_sq_ring : static_cast<char *>(mmap(nullptr, this->_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->_ring_fd, IORING_OFF_CQ_RING));
+            if (this->_cq_ring == MAP_FAILED)
+            {
+                this->_cq_ring = nullptr;
+                return;
+            }
+            this->_sqes_size = ring_params.sq_entries * sizeof(struct io_uring_sqe);
+            void *sqes_map(mmap(nullptr, this->_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->_ring_fd, IORING_OFF_SQES));
+            if (sqes_map == MAP_FAILED)
+                return;
+            this->_sqes = static_cast<struct io_uring_sqe *>(sqes_map);
+
+            this->_sq_head = reinterpret_cast<unsigned *>(this->_sq_ring + ring_params.sq_off.head);
+            this->_sq_tail = reinterpret_cast<unsigned *>(this->_sq_ring + ring_params.sq_off.tail);
+            this->_sq_mask = *reinterpret_cast<unsigned *>(this->_sq_ring + ring_params.sq_off.ring_mask);
+            this->_sq_array = reinterpret_cast<unsigned *>(this->_sq_ring + ring_params.sq_off.array);
+            this->_sq_entries = ring_params.sq_entries;
+            this->_cq_head = reinterpret_cast<unsigned *>(this->_cq_ring + ring_params.cq_off.head);
+            this->_cq_tail = reinterpret_cast<unsigned *>(this->_cq_ring + ring_params.cq_off.tail);
+            this->_cq_mask = *reinterpret_cast<unsigned *>(this->_cq_ring + ring_params.cq_off.ring_mask);
+            this->_cqes = reinterpret_cast<struct io_uring_cqe *>(this->_cq_ring + ring_params.cq_off.cqes);
+            this->_local_sq_tail = *this->_sq_tail;
+
+            this->_ready = this->__probeOperations(_required_ops);
+        };
+
+        FSUringEngine(const FSUringEngine &o) = delete;
+        FSUringEngine &operator=(const FSUringEngine &o) = delete;
+
+        inline const bool Ready(void) const noexcept
+        {
+            return this->_ready;
+        };
+
+        /* next free submission entry(zeroed), nullptr if the submission ring is full */
+        inline struct io_uring_sqe *GetSqe(void) noexcept
+        {
+            const unsigned sq_head(__atomic_load_n(this->_sq_head, __ATOMIC_ACQUIRE));
+            if (this->_local_sq_tail - sq_head >= this->_sq_entries)
+                return nullptr;
+            const unsigned sq_index(this->_local_sq_tail & this->_sq_mask);
+            struct io_uring_sqe *sqe(&this->_sqes[sq_index]);
+            memset(sqe, 0, sizeof(struct io_uring_sqe));
+            this->_sq_array[sq_index] = sq_index;
+            ++this->_local_sq_tail;
+            ++this->_unsubmitted;
+            return sqe;
+        };
+
+        /**
+         *
+         * publish queued entries to the kernel and wait for at least _wait_nr completions.
+         * @param unsigned minimum number of completions to wait for
+         * @returns int number of submitted entries, negative errno on failure
+         */
+        inline int SubmitAndWait(const unsigned _wait_nr) noexcept
+        {
+            __atomic_store_n(this->_sq_tail, this->_local_sq_tail, __ATOMIC_RELEASE);
+            int submitted(0);
+            do
+            {
+                submitted = static_cast<int>(syscall(__NR_io_uring_enter, this->_ring_fd, this->_unsubmitted, _wait_nr, _wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+            } while (submitted < 0 && errno == EINTR);
+            if (submitted < 0)
+                return -errno;
+            this->_unsubmitted -= std::min<unsigned>(this->_unsubmitted, static_cast<unsigned>(submitted));
+            return submitted;
+        };
+
+        /* invoke _handler(const io_uring_cqe&) for every available completion, returns count */
+        template <typename _Handler>
+        inline unsigned ReapCompletions(_Handler &&_handler)
+        {
+            unsigned cq_head(*this->_cq_head), reaped(0);
+            const unsigned cq_tail(__atomic_load_n(this->_cq_tail, __ATOMIC_ACQUIRE));
+            while (cq_head != cq_tail)
+            {
+                const struct io_uring_cqe completion(this->_cqes[cq_head & this->_cq_mask]);
+                ++cq_head;
+                ++reaped;
+                __atomic_store_n(this->_cq_head, cq_head, __ATOMIC_RELEASE);
+                _handler(completion);
+            }
+            return reaped;
+        };
+
+        ~FSUringEngine() noexcept
+        {
+            if (this->_sqes != nullptr)
+                munmap(this->_sqes, this->_sqes_size);
+            if (this->_cq_ring != nullptr && this->_cq_ring != this->_sq_ring)
+                munmap(this->_cq_ring, this->_cq_ring_size);
+            if (this->_sq_ring != nullptr)
+                munmap(this->_sq_ring, this->_sq_ring_size);
+            if (this->_ring_fd >= 0)
+                close(this->_ring_fd);
+        };
+
+    private:
+        int _ring_fd{-1};
+        bool _ready{false};
+        char *_sq_ring{nullptr};
+        char *_cq_ring{nullptr};
+        std::size_t _sq_ring_size{0};
+        std::size_t _cq_ring_size{0};
+        std::size_t _sqes_size{0};
+        struct io_uring_sqe *_sqes{nullptr};
+        struct io_uring_cqe *_cqes{nullptr};
+        unsigned *_sq_head{nullptr};
+        unsigned *_sq_tail{nullptr};
+        unsigned *_sq_array{nullptr};
+        unsigned *_cq_head{nullptr};
+        unsigned *_cq_tail{nullptr};
+        unsigned _sq_mask{0};
+        unsigned _cq_mask{0};
+        unsigned _sq_entries{0};
+        unsigned _local_sq_tail{0};
+        unsigned _unsubmitted{0};
+
+        inline const bool __probeOperations(const std::initializer_list<std::uint8_t> _required_ops) noexcept
+        {
+            if (_required_ops.size() == 0)
+                return true;
+            constexpr std::size_t probe_ops(256);
+            std::vector<char> probe_buffer(sizeof(struct io_uring_probe) + probe_ops * sizeof(struct io_uring_probe_op), 0);
+            struct io_uring_probe *ring_probe(reinterpret_cast<struct io_uring_probe *>(probe_buffer.data()));
+            if (syscall(__NR_io_uring_register, this->_ring_fd, IORING_REGISTER_PROBE, ring_probe, probe_ops) < 0)
+                return false;
+            for (const std::uint8_t required_op : _required_ops)
+                if (required_op > ring_probe->last_op || (ring_probe->ops[required_op].flags & IO_URING_OP_SUPPORTED) == 0)
+                    return false;
+            return true;
+        };
+    };
+#endif
+
+    /*             Template Specialization                   *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+    template <typename _DirLookupType>
+    struct is_dir_lookup_return_type : std::disjunction<std::is_same<_DirLookupType, stDirectoryLookup>, std::is_same<_DirLookupType, std::vector<stDirectoryLookup>>>
+    {
+    };
+
+    template <typename _DirLookupType>
+    inline constexpr bool is_dir_lookup_return_type_v = is_dir_lookup_return_type<_DirLookupType>::value;
+
+    template <typename _DirCollectionType>
+    struct is_dir_collection_return_type : std::disjunction<std::is_same<_DirCollectionType, std::vector<String_t>>, std::is_same<_DirCollectionType, FSPathTable>>
+    {
+    };
+
+    template <typename _DirCollectionType>
+    inline constexpr bool is_dir_collection_return_type_v = is_dir_collection_return_type<_DirCollectionType>::value;
+
+    /*                          Class                        *\
+    \*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+    /**
+     * @class FSController
+     * foreign key type referes to the FK used to allocate/register file descriptor/profilers. will be used to get/set new entries.
+     */
+    template <typename _ForeignKeyType_ = String_t>
+    class FSController
+    {
+        using directoryScanResult_t = std::unordered_map<_ForeignKeyType_, struct stFileDescriptor>;
+        using batchReadCallback_t = std::function<void(struct stFileDescriptor &&)>;
+        using chunkReadCallback_t = std::function<bool(const StringView_t, const std::size_t)>;
+        using verifyIndex_t = std::unordered_map<String_t, stVerifyEntry>;
+        using contentMatchCallback_t = std::function<bool(const stContentMatch &)>;
+
+        /* shared state of a content search */
+        struct stContentSearchState
+        {
+            const StringView_t needle;
+            const contentMatchCallback_t &on_match;
+            const std::size_t max_matches_per_file{0};
+            std::mutex callback_guard{};
+            std::atomic<bool> stop{false};
+            std::atomic<std::size_t> match_count{0};
+        };
+
+        /* shared state of a CollectDirectoryEntriesWithProfiling run, partial results are merged under merge_guard */
+        struct stCollectionAggregation
+        {
+            stDirectoryCollectionStat &result;
+            const bool recursive{true};
+            std::mutex merge_guard{};
+            std::vector<std::size_t> sizes{};
+        };
+
+        /* shared state of a GetDirectorySizeDetachHandler run */
+        struct stSizeAggregation
+        {
+            const stDirectorySizeOptions &options;
+            const std::uint64_t root_device{0};
+            stOperationControl *control{nullptr}; /* async runs only, progress counts directories */
+            std::atomic<std::size_t> total_size{0};
+            FSInodeSet visited_inodes{};
+        };
+
+        /* files of one directory read by a parallel profiler scan, planned once and shared by its batch tasks */
+        struct stDirectoryReadPlan
+        {
+            std::vector<String_t> paths{};
+            std::vector<std::uint64_t> inodes{};         /* walker inode of every path */
+            stScopedDescriptor directory_descriptor{-1}; /* the directory, planner opens are relative to it */
+            std::optional<FSReadPlanner> read_plan{};
+        };
+
+    private:
+
+    std::atomic<bool> sync_backup_exec_state{false};
+        FSShardedProfileRegister _profile_stack_reg; /* file profile stack register, sharded */
+
+        std::uint64_t _fs_instance_uid = GenerateRandomId(); /* fs instance unique id, for copy/move semantics, avoid copy */
+
+        bool _fs_new_instance = false; /* boolean flag indicating if instance is new or used,
+                                          double-free error prevention */
+
+    public:
+        /* FS Controller default Constructor */
+        explicit FSController() noexcept
+        {
+            if (!this->_fs_new_instance)
+                this->_fs_new_instance = true;
+        };
+
+        /* FS Controller Copy Constructor */
+        __0x_attr_FSC_cc FSController(const FSController &_o) noexcept : _profile_stack_reg(_o._profile_stack_reg), _fs_instance_uid(_o._fs_instance_uid), _fs_new_instance(_o._fs_instance_uid) {};
+
+        /* FS Controller Copy Operator Overload */
+        __0x_attr_FSC_cc FSController &operator=(const FSController &_o) noexcept
+        {
+            return *this->__initFsController<const FSController &>(_o);
+        };
+
+        /* FS Controller Move Constructor */
+        __0x_attr_FSC_mc FSController(FSController &&_o) noexcept
+            : _profile_stack_reg(std::move(_o._profile_stack_reg)), _fs_instance_uid(std::move(_o._fs_instance_uid)), _fs_new_instance(std::move(_o._fs_instance_uid)) {};
+
+        /* FS Controller Move Operator Overload */
+        __0x_attr_FSC_mc FSController &operator=(FSController &&_o) noexcept
+        {
+            return *this->__initFsController<FSController &&>(std::move(_o));
+        };
+
+        /* FS Controller Comparision Operator Overload */
+        __0x_attr_FSC_co constexpr bool operator==(const FSController &_o) noexcept
+        {
+            return this->_fs_instance_uid == _o._fs_instance_uid;
+        };
+        __0x_attr_FSC_co constexpr bool operator!=(const FSController &_o) noexcept
+        {
+            return !(this->_fs_instance_uid == _o._fs_instance_uid);
+        };
+
+        /**
+         *
+         * check if file_name exists or not.
+         * @param StringView_t absolute path to target file
+         * @returns bool true if file_name is found, false otherwise
+         *
+         */
+        __0x_attr_FSC_fe inline static const bool FileExists(const StringView_t &file_name) noexcept
+        {
+            if (file_name.empty() || file_name.size() > FS_MAX_FILE_NAME_LENGTH || file_name.find(" ") != std::string::npos) [[unlikely]]
+                return false;
+            return std::filesystem::exists(file_name.data());
+        };
+
+        /**
+         *
+         * check if every file within file_list exists or not, will return failure if even 1
+         * is missing.
+         * @param std::unordered_set<String_t> list with target files
+         * @returns bool true if every target within file_list is found, false otherwise
+         *
+         */
+        __0x_attr_FSC_fe inline static const bool FileExists(const std::unordered_set<String_t> &file_list) noexcept
+        {
+            if (file_list.empty() && file_list.size() > 500000) [[unlikely]]
+                return false;
+
+            for (const String_t &file_name : file_list)
+                if (!FileExists(file_name))
+                    return false;
+
+            return true;
+        };
+
+        /**
+         *
+         * check if file_name is a text file
+         * @param StringView_t absolute path to target file
+         * @returns bool true if file_name is a text file, false otherwise
+         *
+         */
+        __0x_attr_FSC_itf inline static const bool IsTextFile(const StringView_t &file_name) noexcept
+        {
+            if (file_name.empty() || !FileExists(file_name))
+                return false;
+
+            return std::filesystem::is_regular_file(file_name.data());
+        };
+
+        /**
+         *
+         * check if file_name is a executable
+         * @param StringView_t absolute path to target file
+         * @returns bool true if file_name is executable, false otherwise
+         *
+         */
+        __0x_attr_FSC_iex inline static const bool IsExecutable(const StringView_t &file_name) noexcept
+        {
+            if (IsTextFile(file_name.data()))
+            {
+                std::filesystem::perms f_perms = std::filesystem::status(file_name.data()).permissions();
+                if (((f_perms & std::filesystem::perms::owner_exec) != std::filesystem::perms::none) || ((f_perms & std::filesystem::perms::group_exec) != std::filesystem::perms::none) ||
+                    ((f_perms & std::filesystem::perms::others_exec) != std::filesystem::perms::none))
+                    return true;
+            }
+            return false;
+        };
+
+        /**
+         *
+         * check if file_name is a symlink
+         * @param StringView_t absolute path to target symlink
+         * @returns bool true if file_name is symlink, false otherwise
+         *
+         */
+        __0x_attr_FSC_isl inline static const bool IsSymlink(const StringView_t &file_name) noexcept
+        {
+            return std::filesystem::is_symlink(file_name.data());
+        };
+
+        /**
+         *
+         * check if file_name is a directory
+         * @param StringView_t absolute path to target file
+         * @returns bool true if file_name is directory, false otherwise
+         *
+         */
+        __0x_attr_FSC_id inline static const bool IsDirectory(const StringView_t &file_name) noexcept
+        {
+            return std::filesystem::is_directory(file_name.data());
+        };
+
+        /**
+         *
+         * Read _file_name content and return full profiler structure associated with
+         * _file_name.
+         * @param StringView_t the absolute file path to read
+         * @param bool a const boolean flag dictating if _file_name should be created on
+         * missing or not
+         * @returns stFileDescriptor a const read-only access to _file_name associated profile
+         * structure
+         *
+         */
+        __0x_attr_FSC_fr const struct stFileDescriptor FileRead(const StringView_t &_file_name, const bool _create_new = false)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::FILE_READ);
+
+            this->__fileStreamStatusHandle(_file_name, _create_new);
+
+            struct stFileDescriptor new_profiler(this->__createEmptyProfilerStructure(_file_name));
+
+            int fileDescriptor(this->__openFileDescriptor(_file_name, eFileDescriptorMode::READ));
+
+            struct stat file_stat_description(this->__createFileStat(fileDescriptor));
+
+            if (file_stat_description.st_size > 0)
+            {
+                new_profiler.file_size = file_stat_description.st_size;
+
+                fMap_t mapped_data_pointer(this->__createPointerMap(fileDescriptor, file_stat_description.st_size, true, 0));
+                FS_INSTRUMENT_COUNT(eIoCounter::MMAP_CALLS, 1);
+
+                this->__verifyMemMapState(mapped_data_pointer);
+
+                this->__allocMappedBytes(new_profiler.file_content, &mapped_data_pointer, file_stat_description.st_size);
+                FS_INSTRUMENT_COUNT(eIoCounter::BYTES_READ, file_stat_description.st_size);
+
+                this->__descriptorMapClose(fileDescriptor, &mapped_data_pointer, file_stat_description.st_size);
+            }
+            return new_profiler;
+        };
+
+        /**
+         *
+         * Map _file_name read-only and return a view over its content, no bytes are copied, the
+         * mapping lives as long as the returned view.
+         * @param StringView_t the absolute file path to read
+         * @param eMapAdvice optional! access pattern hint applied to the whole mapping
+         * @returns stMappedFileView move-only view over _file_name content
+         *
+         */
+        __0x_attr_FSC_frv stMappedFileView FileReadView(const StringView_t &_file_name, const eMapAdvice _advice = eMapAdvice::NORMAL)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::FILE_READ_VIEW);
+            this->__fileStreamStatusHandle(_file_name, false);
+
+            return this->__mapFileView(_file_name, _advice);
+        };
+
+        /**
+         *
+         * Read every file within _file_names as a batch, keeping up to _queue_depth files in flight.
+         * uses io_uring(openat/statx/read/close submitted in bulk) when the kernel supports it and a
+         * pread thread pool otherwise. the pool claims files in FSReadPlanner order(FS_READ_PLAN_ORDER)
+         * and hints the next ones, io_uring keeps submission order since its statx is asynchronous and
+         * its queue already keeps _queue_depth files in flight. files that cannot be read are skipped.
+         * @param std::vector<String_t>& absolute paths to read
+         * @param std::size_t optional! maximum number of files in flight
+         * @returns std::vector<stFileDescriptor> descriptors in completion order
+         *
+         */
+        __0x_attr_FSC_frm const std::vector<struct stFileDescriptor> FileReadMany(const std::vector<String_t> &_file_names, const std::size_t _queue_depth = FS_BATCH_QUEUE_DEPTH)
+        {
+            std::vector<struct stFileDescriptor> completed_reads;
+            completed_reads.reserve(_file_names.size());
+            this->FileReadMany(_file_names, [&completed_reads](struct stFileDescriptor &&_descriptor)
+                               { completed_reads.push_back(std::move(_descriptor)); }, _queue_depth);
+            return completed_reads;
+        };
+
+        /**
+         *
+         * Read every file within _file_names as a batch, _on_complete receives each descriptor as soon
+         * as its read completes, invocations are serialized.
+         * @param std::vector<String_t>& absolute paths to read
+         * @param batchReadCallback_t& completion callback
+         * @param std::size_t optional! maximum number of files in flight
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_frmc void FileReadMany(const std::vector<String_t> &_file_names, const batchReadCallback_t &_on_complete, const std::size_t _queue_depth = FS_BATCH_QUEUE_DEPTH)
+        {
+            if (_file_names.empty())
+                return;
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::FILE_READ_MANY);
+            const std::size_t queue_depth(std::clamp<std::size_t>(_queue_depth, 1, 4096));
+#if defined(FS_HAS_IO_URING)
+            /* ordering would stat every file serially before the first submission */
+            if (this->__fileReadManyUring(FSReadPlanner(_file_names, eReadOrder::SUBMISSION, 0), _on_complete, queue_depth))
+                return;
+#endif
+            FSReadPlanner read_plan(_file_names);
+            this->__fileReadManyPooled(read_plan, _on_complete, queue_depth);
+        };
+
+        /**
+         *
+         * Stream _file_name in fixed-size chunks, memory use is bounded by two chunk buffers
+         * regardless of file size. reads are hinted sequential, with read_ahead the next chunk is
+         * read by a helper thread while _on_chunk processes the current one, with drop_behind the
+         * consumed range is released from the page cache.
+         * @param StringView_t the absolute file path to read
+         * @param chunkReadCallback_t& receives(chunk, file offset), return false to stop streaming
+         * @param stChunkReadOptions& optional! chunk size, start offset, read-ahead and drop-behind
+         * @returns std::size_t number of bytes handed to _on_chunk
+         *
+         */
+        __0x_attr_FSC_frc std::size_t FileReadChunked(const StringView_t &_file_name, const chunkReadCallback_t &_on_chunk, const stChunkReadOptions &_options = {})
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::FILE_READ_CHUNKED);
+            this->__fileStreamStatusHandle(_file_name, false);
+
+            const std::size_t chunk_size(std::max<std::size_t>(_options.chunk_size, 4096));
+            const stScopedDescriptor descriptor_guard{this->__openFileDescriptor(_file_name, eFileDescriptorMode::READ)};
+            const int fileDescriptor(descriptor_guard.fd);
+#if defined(__linux__)
+            posix_fadvise(fileDescriptor, static_cast<off_t>(_options.start_offset), 0, POSIX_FADV_SEQUENTIAL);
+#endif
+            auto release_consumed = [&](const std::size_t _offset, const std::size_t _length)
+            {
+#if defined(__linux__)
+                if (_options.drop_behind)
+                    posix_fadvise(fileDescriptor, static_cast<off_t>(_offset), static_cast<off_t>(_length), POSIX_FADV_DONTNEED);
+#endif
+            };
+
+            std::size_t delivered_bytes(0), read_offset(_options.start_offset);
+            if (!_options.read_ahead)
+            {
+                std::unique_ptr<char[]> chunk_buffer(std::make_unique<char[]>(chunk_size));
+                while (true)
+                {
+                    const ssize_t read_bytes(__preadFully(fileDescriptor, chunk_buffer.get(), chunk_size, read_offset));
+                    if (read_bytes < 0) [[unlikely]]
+                        throw std::runtime_error(String_t("Error reading file chunk: ") + strerror(errno));
+                    if (read_bytes == 0)
+                        break;
+                    delivered_bytes += static_cast<std::size_t>(read_bytes);
+                    const bool keep_streaming(_on_chunk(StringView_t(chunk_buffer.get(), static_cast<std::size_t>(read_bytes)), read_offset));
+                    release_consumed(read_offset, static_cast<std::size_t>(read_bytes));
+                    read_offset += static_cast<std::size_t>(read_bytes);
+                    if (!keep_streaming || static_cast<std::size_t>(read_bytes) < chunk_size)
+                        break;
+                }
+                return delivered_bytes;
+            }
+
+            /* double buffering, producer fills the free slot while the consumer drains the other */
+            struct stChunkSlot
+            {
+                std::unique_ptr<char[]> data;
+                std::size_t offset{0};
+                ssize_t length{0};
+                int error{0};
+                bool ready{false};
+            };
+            std::array<stChunkSlot, 2> chunk_slots;
+            for (stChunkSlot &slot : chunk_slots)
+                slot.data = std::make_unique<char[]>(chunk_size);
+            std::mutex slot_guard;
+            std::condition_variable slot_cv;
+            bool stop_streaming(false);
+
+            std::thread read_ahead_worker([&]
+                                          {
+                std::size_t producer_offset(_options.start_offset);
+                for (std::size_t slot_index = 0;; slot_index ^= 1)
+                {
+                    stChunkSlot &slot(chunk_slots[slot_index]);
+                    {
+                        std::unique_lock<std::mutex> _lock(slot_guard);
+                        slot_cv.wait(_lock, [&]
+                                     { return stop_streaming || !slot.ready; });
+                        if (stop_streaming)
+                            return;
+                    }
+                    const ssize_t read_bytes(__preadFully(fileDescriptor, slot.data.get(), chunk_size, producer_offset));
+                    const int read_error(read_bytes < 0 ? errno : 0);
+                    {
+                        std::lock_guard<std::mutex> _lock(slot_guard);
+                        slot.offset = producer_offset;
+                        slot.length = read_bytes;
+                        slot.error = read_error;
+                        slot.ready = true;
+                    }
+                    slot_cv.notify_all();
+                    if (read_bytes <= 0 || static_cast<std::size_t>(read_bytes) < chunk_size)
+                        return;
+                    producer_offset += static_cast<std::size_t>(read_bytes);
+                } });
+
+            auto stop_worker = [&]
+            {
+                {
+                    std::lock_guard<std::mutex> _lock(slot_guard);
+                    stop_streaming = true;
+                }
+                slot_cv.notify_all();
+                if (read_ahead_worker.joinable())
+                    read_ahead_worker.join();
+            };
+
+            try
+            {
+                for (std::size_t slot_index = 0;; slot_index ^= 1)
+                {
+                    stChunkSlot &slot(chunk_slots[slot_index]);
+                    {
+                        std::unique_lock<std::mutex> _lock(slot_guard);
+                        slot_cv.wait(_lock, [&]
+                                     { return slot.ready; });
+                    }
+                    if (slot.length < 0) [[unlikely]]
+                        throw std::runtime_error(String_t("Error reading file chunk: ") + strerror(slot.error));
+                    if (slot.length == 0)
+                        break;
+                    delivered_bytes += static_cast<std::size_t>(slot.length);
+                    const bool keep_streaming(_on_chunk(StringView_t(slot.data.get(), static_cast<std::size_t>(slot.length)), slot.offset));
+                    release_consumed(slot.offset, static_cast<std::size_t>(slot.length));
+                    const bool last_chunk(static_cast<std::size_t>(slot.length) < chunk_size);
+                    {
+                        std::lock_guard<std::mutex> _lock(slot_guard);
+                        slot.ready = false;
+                    }
+                    slot_cv.notify_all();
+                    if (!keep_streaming || last_chunk)
+                        break;
+                }
+            }
+            catch (...)
+            {
+                stop_worker();
+                throw;
+            }
+            stop_worker();
+            return delivered_bytes;
+        };
+
+        /**
+         *
+         * put _buffer into file _fle_name, create new _file_name if _create_new is true and
+         * _file_name is not found.
+         * @param StringView_t read only argument value representing absolute path to
+         * _file_name
+         * @param StringView_t read only argument value holding data to be written into
+         * _file_name
+         * @param bool const boolean flag dictating if _file_name should be create if not
+         * found
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_fw inline void FileWrite(const StringView_t &_file_name, const StringView_t &_buffer, const bool _create_new = false)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::FILE_WRITE);
+
+            this->__fileStreamStatusHandle(_file_name, _create_new, _buffer);
+
+            int fileDescriptor(this->__openFileDescriptor(std::move(_file_name), eFileDescriptorMode::WRITE));
+
+            const off_t file_size(_buffer.length());
+
+            this->__descriptorResize(fileDescriptor, file_size);
+
+            fMap_t mapped_data(this->__createPointerMap(fileDescriptor, file_size, false, 0));
+            FS_INSTRUMENT_COUNT(eIoCounter::MMAP_CALLS, 1);
+
+            this->__verifyMemMapState(mapped_data);
+
+            this->__copyMappedMemoryBytes(mapped_data, _buffer);
+            FS_INSTRUMENT_COUNT(eIoCounter::BYTES_WRITTEN, file_size);
+
+            this->__descriptorMapClose(fileDescriptor, &mapped_data, file_size);
+        };
+
+        /**
+         *
+         * put _buffer into _file_name at _offset without truncating, the file grows if the write
+         * ends past its current size, cost is proportional to the bytes written.
+         * @param StringView_t read only argument value representing absolute path to _file_name
+         * @param StringView_t read only argument value holding data to be written
+         * @param std::size_t file offset to write at
+         * @param bool const boolean flag dictating if _file_name should be create if not found
+         * @returns std::size_t number of bytes written
+         *
+         */
+        __0x_attr_FSC_fwa inline std::size_t FileWriteAt(const StringView_t &_file_name, const StringView_t &_buffer, const std::size_t _offset, const bool _create_new = false)
+        {
+            return this->FileWriteGather(_file_name, {_buffer}, eFileWriteMode::POSITIONAL, _offset, _create_new);
+        };
+
+        /**
+         *
+         * append _buffer at the end of _file_name, cost is proportional to the bytes written.
+         * @param StringView_t read only argument value representing absolute path to _file_name
+         * @param StringView_t read only argument value holding data to be appended
+         * @param bool const boolean flag dictating if _file_name should be create if not found
+         * @returns std::size_t number of bytes written
+         *
+         */
+        __0x_attr_FSC_fwa inline std::size_t FileAppend(const StringView_t &_file_name, const StringView_t &_buffer, const bool _create_new = false)
+        {
+            return this->FileWriteGather(_file_name, {_buffer}, eFileWriteMode::APPEND, 0, _create_new);
+        };
+
+        /**
+         *
+         * gather write, put every buffer of _buffers back to back into _file_name with vectored
+         * writes(pwritev/writev), either at _offset or appended depending on _mode.
+         * @param StringView_t read only argument value representing absolute path to _file_name
+         * @param std::vector<StringView_t>& buffers written in order
+         * @param eFileWriteMode positional or append write
+         * @param std::size_t file offset for positional writes, ignored on append
+         * @param bool const boolean flag dictating if _file_name should be create if not found
+         * @returns std::size_t number of bytes written
+         *
+         */
+        __0x_attr_FSC_fwa std::size_t FileWriteGather(const StringView_t &_file_name, const std::vector<StringView_t> &_buffers, const eFileWriteMode _mode = eFileWriteMode::APPEND, const std::size_t _offset = 0,
+                                                      const bool _create_new = false)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::FILE_WRITE_GATHER);
+            this->__fileStreamStatusHandle(_file_name, _create_new);
+
+            const stScopedDescriptor descriptor_guard{this->__openWriteDescriptor(_file_name, _mode == eFileWriteMode::APPEND)};
+
+            std::vector<struct iovec> io_vectors;
+            io_vectors.reserve(_buffers.size());
+            for (const StringView_t &buffer : _buffers)
+                if (!buffer.empty())
+                    io_vectors.push_back(iovec{const_cast<char *>(buffer.data()), buffer.size()});
+
+            return this->__writeVectored(descriptor_guard.fd, io_vectors, _mode == eFileWriteMode::APPEND, _offset);
+        };
+
+        /**
+         *
+         * atomically replace _file_name content with _buffer, data is written to a temp file in the
+         * same directory and renamed into place, readers see either the old or the new content.
+         * with _durable the temp file and parent directory are synced before returning, syncs are
+         * batched with other concurrent durable writers by the group commit scheduler.
+         * @param StringView_t read only argument value representing absolute path to _file_name
+         * @param StringView_t read only argument value holding the new content
+         * @param bool optional! if true, survive a crash once returned
+         * @returns void
+         *
+         * @throws std::runtime_error If the temp file cannot be written, synced or renamed, _file_name is left untouched.
+         * @throws FSDirectorySyncError If the new content is in place but the parent directory could not be synced.
+         */
+        __0x_attr_FSC_fwat void FileWriteAtomic(const StringView_t &_file_name, const StringView_t &_buffer, const bool _durable = true)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::FILE_WRITE_ATOMIC);
+            const String_t final_path(_file_name);
+            const std::filesystem::path target_path(final_path);
+            const String_t temp_path((target_path.parent_path() / ("." + target_path.filename().string() + ".tmp." + std::to_string(GenerateRandomId()))).string());
+
+            struct stat target_stat;
+            const mode_t file_mode(stat(final_path.c_str(), &target_stat) == 0 ? (target_stat.st_mode & 07777) : (S_IRUSR | S_IWUSR));
+            const stScopedDescriptor temp_descriptor{open(temp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, file_mode)};
+            if (temp_descriptor.fd == -1) [[unlikely]]
+                throw std::runtime_error(String_t("Cannot create temp file for atomic write: ") + strerror(errno));
+
+            try
+            {
+                fchmod(temp_descriptor.fd, file_mode);
+                std::vector<struct iovec> io_vectors;
+                if (!_buffer.empty())
+                    io_vectors.push_back(iovec{const_cast<char *>(_buffer.data()), _buffer.size()});
+                this->__writeVectored(temp_descriptor.fd, io_vectors, false, 0);
+
+                if (_durable)
+                {
+                    FSGroupCommitScheduler::Shared().Commit(temp_descriptor.fd, temp_path, final_path);
+                }
+                else if (rename(temp_path.c_str(), final_path.c_str()) == -1)
+                {
+                    throw std::runtime_error(String_t("Cannot rename temp file into place: ") + strerror(errno));
+                }
+            }
+            catch (const FSDirectorySyncError &)
+            {
+                throw; /* the temp file is already renamed into place */
+            }
+            catch (...)
+            {
+                unlink(temp_path.c_str());
+                throw;
+            }
+        };
+
+        /**
+         *
+         * Set the group commit latency window, durable atomic writes issued within the same window
+         * share their directory syncs, larger windows trade latency for throughput.
+         * @param std::chrono::microseconds the window
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_sgcw inline static void SetGroupCommitWindow(const std::chrono::microseconds _window) noexcept
+        {
+            FSGroupCommitScheduler::Shared().SetCommitWindow(_window);
+        };
+
+        /**
+         *
+         * Register new Profile, propagate _new_profile into local register.
+         * @param struct stFileDescriptor new profile to allocate
+         * @param bool if true, source will be moved into destination
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_rnp inline void RegisterNewProfile(struct stFileDescriptor &_new_profile, const bool move_src = false) noexcept
+        {
+            if (_new_profile.file_size > 0) [[likely]]
+            {
+                if (move_src)
+                {
+                    this->_profile_stack_reg.CreateProfile(std::move(_new_profile));
+                    _new_profile = {};
+                }
+                else
+                {
+                    this->_profile_stack_reg.CreateProfile(_new_profile);
+                }
+            }
+        };
+
+        /**
+         *
+         * Register new Profile(bulk mode), propagate _new_profile entries into local register.
+         * @param std::unordered_map<struct stFileDescriptor> profile entries to allocate
+         * @param bool if true, source will be moved into destination
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_rnp inline void RegisterNewProfile(std::unordered_map<String_t, struct stFileDescriptor> &_new_profile, const bool move_src = false) noexcept
+        {
+            if (_new_profile.size() > 0) [[likely]]
+            {
+                std::vector<struct stFileDescriptor *> profile_batch;
+                profile_batch.reserve(_new_profile.size());
+                for (auto &[fk, descriptor] : _new_profile)
+                {
+                    if (descriptor.file_size <= 0)
+                        continue;
+                    profile_batch.push_back(&descriptor);
+                }
+                this->_profile_stack_reg.CreateProfiles(profile_batch, move_src);
+                if (move_src)
+                {
+                    for (auto &src : _new_profile)
+                        src.second.Clean();
+                    _new_profile.erase(_new_profile.begin(), _new_profile.end());
+                }
+            }
+        };
+
+        /**
+         *
+         * Register new Profile(bulk mode), propagate _new_profile entries into local register.
+         * @param std::vector<struct stFileDescriptor> profile entries to allocate
          * @param bool if true, source will be moved into destination
          * @returns void
          *
          */
-        __0x_attr_FSC_rnp inline void RegisterNewProfile(struct stFileDescriptor &_new_profile, const bool move_src = false) noexcept
+        __0x_attr_FSC_rnp inline void RegisterNewProfile(std::vector<struct stFileDescriptor> &_new_profile, const bool move_src) noexcept
+        {
+            if (_new_profile.size() > 0) [[likely]]
+            {
+                std::vector<struct stFileDescriptor *> profile_batch;
+                profile_batch.reserve(_new_profile.size());
+                for (std::size_t profile_counter(0); profile_counter < _new_profile.size(); ++profile_counter)
+                {
+                    if (_new_profile[profile_counter].file_size <= 0)
+                        continue;
+                    profile_batch.push_back(&_new_profile[profile_counter]);
+                }
+                this->_profile_stack_reg.CreateProfiles(profile_batch, move_src);
+                if (move_src)
+                {
+                    _new_profile.erase(_new_profile.begin(), _new_profile.end());
+                }
+            }
+        };
+
+        /**
+         *
+         * Get profiler register stack size
+         * @returns std::size_t the size of register
+         *
+         */
+        __0x_attr_FSC_gss inline std::size_t GetRegisterSize(void) noexcept
+        {
+            return this->_profile_stack_reg.Size();
+        };
+
+        /**
+         *
+         * Bound the profile register to _byte_budget bytes, least recently used profiles are evicted
+         * as soon as the budget is exceeded, 0 removes the byte bound(entry cap still applies).
+         * @param std::size_t the byte budget
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_srbb inline void SetRegisterByteBudget(const std::size_t _byte_budget)
+        {
+            this->_profile_stack_reg.SetByteBudget(_byte_budget);
+        };
+
+        /**
+         *
+         * Store profile contents content-addressed, profiles registered after this call with the same
+         * bytes share a single buffer, GetRegisterStats() reports the resulting dedup ratio.
+         * @param bool true to enable, false to store contents per key again
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_srcd inline void SetRegisterContentDedup(const bool _enabled) noexcept
+        {
+            this->_profile_stack_reg.SetContentDedup(_enabled);
+        };
+
+        /**
+         *
+         * Get profiler register statistics, residency and hit/miss/eviction counters.
+         * @returns stRegisterStats the counters snapshot
+         *
+         */
+        __0x_attr_FSC_grst inline const stRegisterStats GetRegisterStats(void) noexcept
+        {
+            return this->_profile_stack_reg.Stats();
+        };
+
+        /**
+         *
+         * Get process-wide instrumentation, per operation call counts and latency percentiles plus
+         * I/O counters(bytes read/written, mmap calls, walked entries, register hits/misses) merged
+         * from every thread. empty with enabled == false when built with FS_DISABLE_INSTRUMENTATION.
+         * @returns stInstrumentationSnapshot the merged snapshot
+         *
+         */
+        __0x_attr_FSC_gisn inline static const stInstrumentationSnapshot GetInstrumentationSnapshot(void)
+        {
+#if defined(FS_HAS_INSTRUMENTATION)
+            return FSInstrumentation::Shared().Snapshot();
+#else
+            return stInstrumentationSnapshot{};
+#endif
+        };
+
+        /**
+         *
+         * Reset process-wide instrumentation, later snapshots only cover work done after the reset.
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_rins inline static void ResetInstrumentation(void)
+        {
+#if defined(FS_HAS_INSTRUMENTATION)
+            FSInstrumentation::Shared().Reset();
+#endif
+        };
+
+        /**
+         *
+         * Get Instance UID
+         * @returns std::uint64_t the instance associated uid
+         *
+         */
+        __0x_attr_FSC_gci constexpr std::uint64_t &GetFsControllerUID(void) noexcept
+        {
+            return this->_fs_instance_uid;
+        };
+
+        /**
+         *
+         * Get profiler structure data block at _profile_id index.
+         * @param _ForeignKeyType_& reference to register profiler associated FK assigned at
+         * allocation
+         * @returns stFileDescriptor const struct description(profiler) identified by
+         * _profile_id or empty descriptor if not found, this is a deep copy, prefer
+         * GetProfileHandle() on hot paths
+         *
+         */
+        __0x_attr_FSC_gsp inline const struct stFileDescriptor GetProfile(const _ForeignKeyType_ &_profile_id) noexcept
+        {
+            const ProfileHandle_t profile_handle(this->_profile_stack_reg.GetProfile(_profile_id));
+            return profile_handle ? profile_handle->ToDescriptor() : stFileDescriptor{};
+        };
+
+        /**
+         *
+         * Get a shared read-only handle to the profile identified by _profile_id, no content is
+         * copied, the handle keeps the profile alive even after eviction or deletion.
+         * @param _ForeignKeyType_& reference to register profiler associated FK
+         * @returns ProfileHandle_t the profile handle, nullptr if not found
+         *
+         */
+        __0x_attr_FSC_gph inline ProfileHandle_t GetProfileHandle(const _ForeignKeyType_ &_profile_id)
+        {
+            return this->_profile_stack_reg.GetProfile(_profile_id);
+        };
+
+        /**
+         *
+         * Get handles to every registered profile, contents are shared with the register, not copied.
+         * @returns std::vector<ProfileHandle_t> the register snapshot
+         *
+         */
+        __0x_attr_FSC_grsn inline const std::vector<ProfileHandle_t> GetRegisterSnapshot(void)
+        {
+            return this->_profile_stack_reg.Handles();
+        };
+
+        /**
+         *
+         * Get read-only internal stack register, every shard merged into a single copy
+         * @returns stProfilerStackRegister returns the internal register
+         *
+         */
+        __0x_attr_FSC_gsptr inline const struct stProfilerStackRegister GetStackPointer(void) noexcept
+        {
+            return this->_profile_stack_reg.Snapshot();
+        };
+
+        /**
+         *
+         * delete a profile identified by _profile_id aka FK
+         * @param _ForeignKeyType_& reference to register profiler associated FK
+         * @param bool if true, will unlink globally, meaning the actual file will be removed
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_dprf inline void DeleteProfile(const _ForeignKeyType_ &_profile_id) noexcept
+        {
+            this->_profile_stack_reg.EraseProfile(_profile_id);
+        };
+
+        /**
+         *
+         * Create _file_name.
+         * @param StringView_t the absolute path to _file_name
+         * @param StringView_t content to write into the file, defaults to nothing
+         * @returns bool if created, true
+         *
+         */
+        __0x_attr_FSC_cfl inline const bool CreateFile(const StringView_t &_file_name,
+
+                                                                                                                                                       const StringView_t &_content = "")
+        {
+            std::ofstream fileCreate(_file_name.data());
+            if (!fileCreate)
+                throw std::runtime_error(std::move(String_t("File Create: ") + strerror(errno)));
+
+            if (!_content.empty())
+            {
+                fileCreate.write(_content.data(), _content.length());
+            }
+            fileCreate.close();
+
+            return FileExists(_file_name);
+        };
+
+        /**
+         *
+         * Create a directory.
+         * @param StringView_t& directory path to create
+         * @returns bool true if directory was created
+         *
+         */
+        __0x_attr_FSC_cdir inline const bool CreateDirectory(const StringView_t &_directory) noexcept
+        {
+            std::filesystem::create_directories(_directory);
+            return std::filesystem::is_directory(_directory);
+        };
+
+        /**
+         *
+         * Collect directory entries from _directory, if _recursive is true, it will traverse the entire
+         * directories within _directory. collect into an FSPathTable(CollectDirectoryEntries<FSPathTable>)
+         * to store every directory once and avoid one allocation per path on large trees.
+         * @param StringView_t& directory to collect from
+         * @param bool optional! if true then recursive traversal
+         * @returns std::vector<String_t> or FSPathTable containing entries from _directory scan.
+         *
+         */
+        template <typename _collectionReturnType = std::vector<String_t>, typename = std::enable_if_t<is_dir_collection_return_type_v<_collectionReturnType>>>
+        __0x_attr_FSC_cdire _collectionReturnType CollectDirectoryEntries(const StringView_t &_directory,
+                                                                          const bool _recursive = false)
+        {
+            _collectionReturnType collected_entries;
+            if (_directory.empty())
+                return collected_entries;
+            FSDirectoryWalker::Walk(_directory, stWalkOptions{.recursive = _recursive}, [&collected_entries](const stWalkEntry &d_entry)
+                                    {
+                if (d_entry.ResolvedType() != eDirEntryType::REGULAR)
+                    return;
+                if constexpr (std::is_same_v<_collectionReturnType, FSPathTable>)
+                    collected_entries.Add(d_entry.path);
+                else
+                    collected_entries.emplace_back(d_entry.path); });
+            return collected_entries;
+        };
+
+        /**
+         *
+         * Collect directory entries if any, constructs an object containing the collection entry
+         * size statistics(min/max/mean/percentiles, log2 size histogram, per extension totals, newest
+         * entry) along with a register containing entry name(path) and a collection array size.
+         * single pass, every directory is a task on a work-stealing pool and every regular file(symlinks
+         * resolved) costs one statx(type, size, mtime), register order is unspecified.
+         * @param StringView_t& directory to collect and profile
+         * @param bool bit flag mandating recursive iteration or not
+         * @param std::size_t threshold to use for register allocation, if register size do not exceed
+         * or touch the threshold, structure will be deleted and empty block returned.
+         * @param std::size_t optional! number of workers, 0 uses hardware concurrency
+         * @returns stDirectoryCollectionStat a structure containing directory profiling information,
+         * register stack, register size, entry size statistics.
+         *
+         */
+        inline const stDirectoryCollectionStat CollectDirectoryEntriesWithProfiling(const StringView_t &_directory, const bool _recursive, const std::size_t _threshold = 1, const std::size_t _worker_count = 0)
+        {
+            stDirectoryCollectionStat new_collection_stat;
+            if (_directory.empty())
+                return new_collection_stat;
+            if (!IsDirectory(_directory))
+                throw std::filesystem::filesystem_error("Cannot open directory", _directory, std::make_error_code(std::errc::not_a_directory));
+
+            stCollectionAggregation collection_state{.result{new_collection_stat}, .recursive{_recursive}};
+            new_collection_stat.min_size = std::numeric_limits<std::size_t>::max();
+            FSWorkStealingPool worker_pool(_recursive ? _worker_count : 1);
+            {
+                FSTaskGroup task_group(worker_pool);
+                __parallelCollection(static_cast<String_t>(_directory), task_group, collection_state);
+                task_group.Wait();
+            }
+
+            std::vector<std::size_t> &entry_sizes(collection_state.sizes);
+            new_collection_stat.registry_size = new_collection_stat.registry.size();
+            if (new_collection_stat.registry_size > 0)
+            {
+                new_collection_stat.mean_size = static_cast<double>(new_collection_stat.total_size) / static_cast<double>(new_collection_stat.registry_size);
+                /* nearest-rank percentile, the ceil(rank * n)-th smallest size */
+                auto nearest_rank = [&entry_sizes](const double _rank) -> std::size_t
+                {
+                    const double rank_position(std::ceil(_rank * static_cast<double>(entry_sizes.size())));
+                    const std::size_t rank_index(rank_position <= 1.0 ? 0 : std::min(entry_sizes.size() - 1, static_cast<std::size_t>(rank_position) - 1));
+                    std::nth_element(entry_sizes.begin(), entry_sizes.begin() + rank_index, entry_sizes.end());
+                    return entry_sizes[rank_index];
+                };
+                new_collection_stat.p50_size = nearest_rank(0.50);
+                new_collection_stat.p90_size = nearest_rank(0.90);
+                new_collection_stat.p99_size = nearest_rank(0.99);
+            }
+            else
+            {
+                new_collection_stat.min_size = 0;
+            }
+            if (new_collection_stat.registry_size < _threshold)
+            {
+                new_collection_stat = {};
+            }
+            return new_collection_stat;
+        };
+
+        /**
+         *
+         * Scan directory recursively, aggregate every entry which is a regular file type and return the
+         * aggregation.
+         * @param StringView_t& path to aggregate from
+         * @returns directoryScanResult_t the aggregation
+         *
+         */
+        __0x_attr_FSC_dirprf const directoryScanResult_t DirectoryProfiler(const StringView_t &path)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::DIRECTORY_PROFILER);
+            directoryScanResult_t scan_result;
+
+            if (path.empty())
+                return scan_result;
+            if (path.length() < FS_MAX_FILE_NAME_LENGTH)
+            {
+                if (!std::filesystem::path(path).is_absolute())
+                    throw std::runtime_error("Use an absolute path please!");
+                this->__recursiveAggregation(path, scan_result);
+            }
+            return scan_result;
+        };
+
+        /**
+         *
+         * Scan directory recursively on a work-stealing pool, directory expansion and file reads are
+         * spread across _worker_count workers, every worker aggregates into its own partial result
+         * and partials are spliced together once the walk completes.
+         * @param StringView_t& path to aggregate from
+         * @param std::size_t number of workers for this call, 0 uses hardware concurrency
+         * @returns directoryScanResult_t the aggregation
+         *
+         */
+        __0x_attr_FSC_dirprf const directoryScanResult_t DirectoryProfiler(const StringView_t &path, const std::size_t _worker_count)
+        {
+            if (path.empty() || path.length() >= FS_MAX_FILE_NAME_LENGTH)
+                return directoryScanResult_t{};
+            FSWorkStealingPool worker_pool(_worker_count);
+            return this->__directoryProfilerParallel(path, worker_pool, nullptr);
+        };
+
+        /**
+         *
+         * Delete a file_name, this action is not reversible.
+         * @param StringView_t& path to file to remove
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_delfl inline static void DeleteFile(const StringView_t &file_name)
+        {
+            if (file_name.empty())
+                return;
+            if (FileExists(file_name))
+            {
+                if (std::filesystem::is_regular_file(file_name))
+                {
+                    std::filesystem::remove(file_name);
+                }
+            }
+        };
+
+        /**
+         *
+         * Create a backup copy of dir_source directory as dir_dest, to override existing destination
+         * files set dest_override to true, to copy empty files set copy_empty_files to true.
+         * @param StringView_t& the source directory to copy
+         * @param StringView_t dir_dest the destination backup directory
+         * @param bool optional! it true will override existing files
+         * @param bool optional! if true will copy empty files
+         * @returns bool true if backup was successful
+         *
+         */
+        __0x_attr_FSC_cdbk const bool CreateDirectoryBackup(const StringView_t &dir_source, const StringView_t &dir_dest, const bool create_backup_dir = false, const bool dest_override = false, const bool copy_empty_files = false)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::DIRECTORY_BACKUP);
+            try
+            {
+                const bool is_source(IsDirectory(dir_source)), is_destination(IsDirectory(dir_dest));
+
+                if (!is_source)
+                    throw std::runtime_error("source directory not valid for backup!");
+                else if(!is_destination && create_backup_dir)    
+                    std::filesystem::create_directories(dir_dest);
+                
+                if (IsDirectory(dir_dest))
+                {
+                    const std::filesystem::path destination_root(dir_dest);
+                    FSDirectoryWalker::Walk(dir_source, stWalkOptions{}, [&](const stWalkEntry &d_entry)
+                                            {
+                        const std::filesystem::path destinationPath(destination_root / d_entry.relative);
+                        const eDirEntryType entry_type(d_entry.ResolvedType());
+
+                        if (entry_type == eDirEntryType::DIRECTORY)
+                        {
+                            if (!std::filesystem::exists(destinationPath))
+                            {
+                                std::filesystem::create_directories(destinationPath);
+                            }
+                        }
+                        else if (entry_type != eDirEntryType::UNKNOWN)
+                        {
+                            struct stat entry_stat;
+                            if (!copy_empty_files && (!d_entry.Stat(entry_stat, true) || entry_stat.st_size <= 0))
+                                return;
+                            if (std::filesystem::copy_file(d_entry.path, destinationPath, dest_override ? std::filesystem::copy_options::overwrite_existing : std::filesystem::copy_options::skip_existing))
+                            {
+                                /* copy_file does not keep the mtime, METADATA verification relies on it */
+                                std::error_code time_error;
+                                std::filesystem::last_write_time(destinationPath, std::filesystem::last_write_time(std::filesystem::path(d_entry.path), time_error), time_error);
+                            }
+                        } });
+                    this->sync_backup_exec_state = this->__directoryBackupVerify(dir_source, dir_dest, eBackupVerifyMode::SIZE, copy_empty_files);
+                }
+                else
+                {
+                    throw std::filesystem::filesystem_error::runtime_error("destination directory not created!");
+                }
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "Error: " << e.what() << "\n";
+                this->sync_backup_exec_state = false;
+            }
+            return this->sync_backup_exec_state;
+        };
+
+
+        /**
+         *
+         * Incremental parallel backup of dir_source into dir_dest. files whose destination copy has
+         * the same size and modification time are skipped, the others are copied on a worker pool
+         * with an in-kernel copy: reflink(FICLONE) when the filesystem supports it, copy_file_range
+         * otherwise, plain read/write as last resort. copies inherit source mode and mtime so the
+         * next run can skip them.
+         * @param StringView_t& the source directory to copy
+         * @param StringView_t& the destination backup directory
+         * @param stBackupOptions& optional! incremental mode, worker count, directory creation, empty files
+         * @returns stBackupReport copy/skip/failure counters, success is false if anything failed
+         *
+         */
+        __0x_attr_FSC_cdbki const stBackupReport CreateDirectoryBackupIncremental(const StringView_t &dir_source, const StringView_t &dir_dest, const stBackupOptions &_options = {})
+        {
+            FSWorkStealingPool worker_pool(_options.worker_count);
+            const stBackupReport backup_report(this->__directoryBackupIncremental(dir_source, dir_dest, _options, worker_pool, nullptr));
+            this->sync_backup_exec_state = backup_report.success;
+            return backup_report;
+        };
+
+        /**
+         *
+         * Verify a backup file by file, both trees are walked concurrently and every regular file is
+         * compared by relative path. SIZE and METADATA only use stat data, CONTENT_HASH additionally
+         * hashes(XXH64) every pair of same sized files on a worker pool.
+         * @param StringView_t& the source directory
+         * @param StringView_t& the backup directory
+         * @param eBackupVerifyMode optional! the comparison tier
+         * @param std::size_t optional! hashing workers, 0 uses hardware concurrency
+         * @returns stBackupVerifyReport sorted mismatched/missing/extra paths, verified if all empty
+         *
+         * @throws std::filesystem::filesystem_error If one of the directories cannot be walked.
+         */
+        __0x_attr_FSC_dbkv const stBackupVerifyReport DirectoryBackupVerify(const StringView_t &dir_source, const StringView_t &dir_dest, const eBackupVerifyMode _mode = eBackupVerifyMode::CONTENT_HASH, const std::size_t _worker_count = 0)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::DIRECTORY_BACKUP_VERIFY);
+            stBackupVerifyReport verify_report;
+            FSWorkStealingPool worker_pool(_worker_count);
+            FSTaskGroup task_group(worker_pool);
+
+            verifyIndex_t source_index, destination_index;
+            task_group.Run([&dir_source, &source_index]
+                           { __collectVerifyIndex(dir_source, source_index); });
+            __collectVerifyIndex(dir_dest, destination_index);
+            task_group.Wait();
+
+            std::vector<std::pair<stVerifyEntry *, stVerifyEntry *>> hash_pairs;
+            for (auto &[relative_path, source_entry] : source_index)
+            {
+                const auto destination_entry(destination_index.find(relative_path));
+                if (destination_entry == destination_index.end())
+                {
+                    verify_report.missing.push_back(relative_path);
+                    continue;
+                }
+                ++verify_report.files_compared;
+                if (source_entry.size != destination_entry->second.size ||
+                    (_mode == eBackupVerifyMode::METADATA && (source_entry.mtime.tv_sec != destination_entry->second.mtime.tv_sec || source_entry.mtime.tv_nsec != destination_entry->second.mtime.tv_nsec)))
+                    verify_report.mismatched.push_back(relative_path);
+                else if (_mode == eBackupVerifyMode::CONTENT_HASH)
+                    hash_pairs.emplace_back(&source_entry, &destination_entry->second);
+            }
+            for (const auto &[relative_path, destination_entry] : destination_index)
+                if (source_index.find(relative_path) == source_index.end())
+                    verify_report.extra.push_back(relative_path);
+
+            if (!hash_pairs.empty())
+            {
+                std::atomic<std::size_t> bytes_hashed{0};
+                for (std::size_t batch_begin = 0; batch_begin < hash_pairs.size(); batch_begin += FS_PARALLEL_READ_BATCH)
+                {
+                    const std::size_t batch_end(std::min(hash_pairs.size(), batch_begin + FS_PARALLEL_READ_BATCH));
+                    task_group.Run([&hash_pairs, &bytes_hashed, batch_begin, batch_end]
+                                   {
+                        std::unique_ptr<char[]> hash_buffer(std::make_unique<char[]>(FS_STREAM_CHUNK_SIZE));
+                        std::size_t batch_bytes(0);
+                        for (std::size_t i = batch_begin; i < batch_end; ++i)
+                        {
+                            for (stVerifyEntry *entry : {hash_pairs[i].first, hash_pairs[i].second})
+                            {
+                                entry->hashed = __hashFileContent(entry->path, hash_buffer.get(), entry->hash);
+                                batch_bytes += entry->hashed ? entry->size : 0;
+                            }
+                        }
+                        bytes_hashed.fetch_add(batch_bytes, std::memory_order_relaxed); });
+                }
+                task_group.Wait();
+                verify_report.bytes_hashed = bytes_hashed.load();
+
+                for (const auto &[source_entry, destination_entry] : hash_pairs)
+                    if (!source_entry->hashed || !destination_entry->hashed || source_entry->hash != destination_entry->hash)
+                        verify_report.mismatched.push_back(String_t(source_entry->path).substr(source_entry->relative_offset));
+            }
+
+            std::sort(verify_report.mismatched.begin(), verify_report.mismatched.end());
+            std::sort(verify_report.missing.begin(), verify_report.missing.end());
+            std::sort(verify_report.extra.begin(), verify_report.extra.end());
+            verify_report.verified = verify_report.mismatched.empty() && verify_report.missing.empty() && verify_report.extra.empty();
+            return verify_report;
+        };
+
+        bool CreateDirectoryBackupJoinExecution(const StringView_t &dir_source, const StringView_t &dir_dest, const bool create_backup_dir = false, const bool dest_override = false, const bool copy_empty_files = false)
+        {
+            this->sync_backup_exec_state = false;
+            std::thread sync_execute([&]{return this->CreateDirectoryBackup(dir_source, dir_dest, create_backup_dir, dest_override, copy_empty_files);});
+            if(sync_execute.joinable()) sync_execute.join();
+            return this->sync_backup_exec_state;
+        };
+
+        /**
+         *
+         * Check if directory contains a specific file type or file name, s_node is matched within
+         * file names(glob characters make it a whole name glob, see FSNameMatcher).
+         * @param StringView_t& the directory to scan
+         * @param StringView_t& the file type or file name to lookup
+         * @param bool optional! if true, scan subdirectories too
+         * @returns stDirectoryLookup the first match, or std::vector<stDirectoryLookup> every match
+         *
+         */
+        template <typename _lookupReturnType = stDirectoryLookup, typename = std::enable_if_t<is_dir_lookup_return_type_v<_lookupReturnType>>>
+        __0x_attr_FSC_dcft inline const _lookupReturnType DirectoryContainsFileType(
+            const StringView_t &directory, const StringView_t &s_node, const bool recursive_scan = false)
+        {
+            if (s_node.empty() || s_node.length() > FS_MAX_FILE_NAME_LENGTH)
+                return _lookupReturnType{};
+            return this->DirectoryContainsFileType<_lookupReturnType>(directory, FSNameMatcher({String_t(s_node)}), recursive_scan);
+        };
+
+        /**
+         *
+         * Check if directory contains files matching any of _patterns, all patterns are compiled into
+         * a single matcher and tested while walking.
+         * @param StringView_t& the directory to scan
+         * @param std::vector<String_t>& literal(substring) or glob(whole name) patterns
+         * @param bool optional! if true, scan subdirectories too
+         * @returns stDirectoryLookup the first match, or std::vector<stDirectoryLookup> every match
+         *
+         */
+        template <typename _lookupReturnType = stDirectoryLookup, typename = std::enable_if_t<is_dir_lookup_return_type_v<_lookupReturnType>>>
+        __0x_attr_FSC_dcft inline const _lookupReturnType DirectoryContainsFileType(
+            const StringView_t &directory, const std::vector<String_t> &_patterns, const bool recursive_scan = false)
+        {
+            return this->DirectoryContainsFileType<_lookupReturnType>(directory, FSNameMatcher(_patterns), recursive_scan);
+        };
+
+        /**
+         *
+         * DirectoryContainsFileType for a braced pattern list, e.g. {".log", "*.cpp"}. a braced list
+         * would otherwise be ambiguous between StringView_t(iterator pair) and std::vector<String_t>.
+         * @param StringView_t& the directory to scan
+         * @param std::initializer_list<StringView_t> literal(substring) or glob(whole name) patterns
+         * @param bool optional! if true, scan subdirectories too
+         * @returns stDirectoryLookup the first match, or std::vector<stDirectoryLookup> every match
+         *
+         */
+        template <typename _lookupReturnType = stDirectoryLookup, typename = std::enable_if_t<is_dir_lookup_return_type_v<_lookupReturnType>>>
+        __0x_attr_FSC_dcft inline const _lookupReturnType DirectoryContainsFileType(
+            const StringView_t &directory, const std::initializer_list<StringView_t> _patterns, const bool recursive_scan = false)
+        {
+            return this->DirectoryContainsFileType<_lookupReturnType>(directory, FSNameMatcher(std::vector<String_t>(_patterns.begin(), _patterns.end())), recursive_scan);
+        };
+
+        /**
+         *
+         * Streaming lookup with a precompiled matcher, entries are matched as the walk produces them,
+         * the walk stops at the first match when a single stDirectoryLookup is requested.
+         * @param StringView_t& the directory to scan
+         * @param FSNameMatcher& the compiled patterns
+         * @param bool optional! if true, scan subdirectories too
+         * @returns stDirectoryLookup the first match, or std::vector<stDirectoryLookup> every match
+         *
+         * @throws std::filesystem::filesystem_error If directory cannot be read.
+         */
+        template <typename _lookupReturnType = stDirectoryLookup, typename = std::enable_if_t<is_dir_lookup_return_type_v<_lookupReturnType>>>
+        __0x_attr_FSC_dcft inline const _lookupReturnType DirectoryContainsFileType(
+            const StringView_t &directory, const FSNameMatcher &_name_matcher, const bool recursive_scan = false)
+        {
+            _lookupReturnType lookup_result{};
+
+            if (directory.empty() || _name_matcher.Empty() || directory.size() > FS_MAX_FILE_NAME_LENGTH)
+                return lookup_result;
+
+            FSDirectoryWalker::Walk(directory, stWalkOptions{.recursive = recursive_scan}, [&lookup_result, &_name_matcher](const stWalkEntry &d_entry)
+                                    {
+                if (d_entry.type == eDirEntryType::DIRECTORY)
+                    return eWalkAction::CONTINUE;
+                const std::size_t pattern_index(_name_matcher.Match(d_entry.name));
+                if (pattern_index == FSNameMatcher::npos || d_entry.ResolvedType() != eDirEntryType::REGULAR)
+                    return eWalkAction::CONTINUE;
+
+                stDirectoryLookup lookup_match{.path{String_t(d_entry.path)}, .file{String_t(d_entry.name)}, .has_found = true, .pattern_index = pattern_index};
+                if constexpr (std::is_same_v<_lookupReturnType, stDirectoryLookup>)
+                {
+                    lookup_result = std::move(lookup_match);
+                    return eWalkAction::STOP;
+                }
+                else
+                {
+                    lookup_result.push_back(std::move(lookup_match));
+                    return eWalkAction::CONTINUE;
+                } });
+            return lookup_result;
+        };
+
+        /**
+         * 
+         * Wipe Entire directory contents without possibility of reversing the action, remove contents and based on force_empty_folder also empty folders.
+         * @param StringView_t& directory target
+         * @param bool if force the deletion of empty folders...
+         * @returns void
+         * 
+         */
+        __0x_attr_FSC_dirwp inline void DirectoryWipe(const StringView_t &_directory, const bool force_empty_folder)
+        {
+            if (_directory.empty() || !IsDirectory(_directory))
+                return;
+
+            FSDirectoryWalker::Walk(_directory, stWalkOptions{.post_order = force_empty_folder}, [force_empty_folder](const stWalkEntry &block)
+                                    {
+                if (block.type == eDirEntryType::DIRECTORY && !block.post_visit)
+                    return;
+                if (unlinkat(block.parent_fd, block.name.data(), block.post_visit ? AT_REMOVEDIR : 0) == -1 && errno != ENOENT)
+                    throw std::filesystem::filesystem_error("Cannot remove", block.path, std::error_code(errno, std::generic_category())); });
+
+            if (force_empty_folder && rmdir(static_cast<String_t>(_directory).c_str()) == -1 && errno != ENOENT)
+                throw std::filesystem::filesystem_error("Cannot remove", _directory, std::error_code(errno, std::generic_category()));
+        };
+
+#if defined(FS_HAS_INOTIFY)
+        /**
+         *
+         * Profile path like DirectoryProfiler(path, _worker_count) and keep the result current, the
+         * returned watcher re-reads created/modified files and drops deleted ones as inotify reports
+         * them, _callback is told about every change. the watcher reads files through this instance,
+         * destroy it before the controller.
+         * @param StringView_t& absolute path to watch
+         * @param watchCallback_t optional! change callback, runs on the watcher thread
+         * @param std::size_t optional! workers for the initial scan, 0 uses hardware concurrency
+         * @returns std::unique_ptr<FSDirectoryWatcher> the running watcher, nullptr if path is not a directory
+         *
+         * @throws std::runtime_error If path is not absolute or inotify cannot watch the tree.
+         */
+        __0x_attr_FSC_wdp std::unique_ptr<FSDirectoryWatcher> WatchDirectoryProfiler(const StringView_t &path, FSDirectoryWatcher::watchCallback_t _callback = nullptr, const std::size_t _worker_count = 0)
+        {
+            if (path.empty() || path.length() >= FS_MAX_FILE_NAME_LENGTH)
+                return nullptr;
+            if (!std::filesystem::path(path).is_absolute())
+                throw std::runtime_error("Use an absolute path please!");
+            if (!IsDirectory(path))
+                return nullptr;
+
+            auto directory_watcher(std::make_unique<FSDirectoryWatcher>(path, [this](const String_t &_file_path, struct stFileDescriptor &_description)
+                                                                        { return this->__profileFile(_file_path, _description); }, std::move(_callback)));
+            directoryScanResult_t scan_result(this->DirectoryProfiler(path, _worker_count));
+            FSDirectoryWatcher::liveMap_t initial_profile;
+            for (auto &[fk, scanned_profile] : scan_result)
+                initial_profile.insert_or_assign(scanned_profile.file_name, std::move(scanned_profile));
+            directory_watcher->Start(std::move(initial_profile));
+            return directory_watcher;
+        };
+#endif
+
+        /**
+         *
+         * Persist a DirectoryProfiler result as a scan index(see FSScanIndex), every profiled file is
+         * stat'ed for its size, mtime and inode, content hashes are computed from the profiled
+         * content. a file whose size no longer matches its profile is re-hashed from disk so hash
+         * and metadata describe the same content, files changing while re-hashed are left out. the
+         * index file is replaced atomically.
+         * @param directoryScanResult_t& the scan to persist
+         * @param StringView_t& path of the index file
+         * @param bool optional! if true, store XXH64 content hashes
+         * @returns std::size_t the number of indexed files, vanished and changing files are left out
+         *
+         * @throws std::runtime_error If the index file cannot be written.
+         */
+        __0x_attr_FSC_ssi std::size_t SaveScanIndex(const directoryScanResult_t &_scan_result, const StringView_t &_index_path, const bool _content_hashes = true)
+        {
+            std::vector<stScanIndexRecord> index_records;
+            std::unique_ptr<char[]> hash_buffer; /* allocated by the first re-hash */
+            index_records.reserve(_scan_result.size());
+            for (const auto &[fk, scanned_profile] : _scan_result)
+            {
+                struct stat file_stat;
+                if (stat(scanned_profile.file_name.c_str(), &file_stat) == -1)
+                    continue;
+                std::uint64_t content_hash(0);
+                if (_content_hashes && static_cast<std::size_t>(file_stat.st_size) == scanned_profile.file_content.size())
+                {
+                    content_hash = FSContentHash::Hash(scanned_profile.file_content.data(), scanned_profile.file_content.size());
+                }
+                else if (_content_hashes)
+                {
+                    /* changed since it was profiled, the profiled content would pair an old hash with new metadata */
+                    if (!hash_buffer)
+                        hash_buffer = std::make_unique<char[]>(FS_STREAM_CHUNK_SIZE);
+                    struct stat rehashed_stat;
+                    if (!__hashFileContent(scanned_profile.file_name, hash_buffer.get(), content_hash) || stat(scanned_profile.file_name.c_str(), &rehashed_stat) == -1 ||
+                        rehashed_stat.st_size != file_stat.st_size || rehashed_stat.st_ino != file_stat.st_ino || rehashed_stat.st_dev != file_stat.st_dev ||
+                        __statMtime(rehashed_stat).tv_sec != __statMtime(file_stat).tv_sec || __statMtime(rehashed_stat).tv_nsec != __statMtime(file_stat).tv_nsec)
+                        continue;
+                }
+                index_records.push_back(stScanIndexRecord{.path{scanned_profile.file_name},
+                                                          .size = static_cast<std::uint64_t>(file_stat.st_size),
+                                                          .mtime{__statMtime(file_stat)},
+                                                          .inode = static_cast<std::uint64_t>(file_stat.st_ino),
+                                                          .device = static_cast<std::uint64_t>(file_stat.st_dev),
+                                                          .content_hash = content_hash});
+            }
+            this->FileWriteAtomic(_index_path, FSScanIndex::Serialize(index_records, _content_hashes));
+            return index_records.size();
+        };
+
+        /**
+         *
+         * Build a scan index of _directory from metadata alone, regular files(symlinks resolved) are
+         * stat'ed during a single walk, content hashes are optional and computed on a worker pool.
+         * @param StringView_t& the directory to index
+         * @param StringView_t& path of the index file
+         * @param bool optional! if true, read every file and store XXH64 content hashes
+         * @param std::size_t optional! hashing workers, 0 uses hardware concurrency
+         * @returns std::size_t the number of indexed files
+         *
+         * @throws std::runtime_error If the index file cannot be written.
+         * @throws std::filesystem::filesystem_error If _directory cannot be walked.
+         */
+        __0x_attr_FSC_ssi std::size_t BuildScanIndex(const StringView_t &_directory, const StringView_t &_index_path, const bool _content_hashes = false, const std::size_t _worker_count = 0)
+        {
+            std::vector<stScanIndexRecord> index_records;
+            FSDirectoryWalker::Walk(_directory, stWalkOptions{}, [&index_records](const stWalkEntry &d_entry)
+                                    {
+                stEntryStat entry_stat;
+                if (d_entry.type == eDirEntryType::DIRECTORY || d_entry.type == eDirEntryType::OTHER)
+                    return;
+                if (!d_entry.StatFields(entry_stat, STAT_FIELD_TYPE | STAT_FIELD_SIZE | STAT_FIELD_MTIME | STAT_FIELD_INODE, true) || !S_ISREG(entry_stat.mode))
+                    return;
+                index_records.push_back(stScanIndexRecord{.path{String_t(d_entry.path)}, .size = entry_stat.size, .mtime{entry_stat.mtime}, .inode = entry_stat.inode, .device = entry_stat.device}); });
+
+            if (_content_hashes && !index_records.empty())
+            {
+                FSWorkStealingPool worker_pool(_worker_count);
+                FSTaskGroup task_group(worker_pool);
+                for (std::size_t batch_begin = 0; batch_begin < index_records.size(); batch_begin += FS_PARALLEL_READ_BATCH)
+                {
+                    const std::size_t batch_end(std::min(index_records.size(), batch_begin + FS_PARALLEL_READ_BATCH));
+                    task_group.Run([&index_records, batch_begin, batch_end]
+                                   {
+                        std::unique_ptr<char[]> hash_buffer(std::make_unique<char[]>(FS_STREAM_CHUNK_SIZE));
+                        for (std::size_t i = batch_begin; i < batch_end; ++i)
+                            if (!__hashFileContent(index_records[i].path, hash_buffer.get(), index_records[i].content_hash))
+                                index_records[i].content_hash = 0; });
+                }
+                task_group.Wait();
+            }
+            this->FileWriteAtomic(_index_path, FSScanIndex::Serialize(index_records, _content_hashes));
+            return index_records.size();
+        };
+
+        /**
+         *
+         * Map a scan index written by SaveScanIndex/BuildScanIndex, only the header is validated so
+         * opening is constant time, entries can then be queried straight from the mapping and
+         * revalidated against the filesystem on demand(FSScanIndex::Revalidate).
+         * @param StringView_t& path of the index file
+         * @returns FSScanIndex the mapped index, Valid() is false if the file is not a compatible index
+         *
+         * @throws std::runtime_error If the index file cannot be opened or mapped.
+         */
+        __0x_attr_FSC_osi FSScanIndex OpenScanIndex(const StringView_t &_index_path)
+        {
+            return FSScanIndex(this->__mapFileView(_index_path, eMapAdvice::RANDOM));
+        };
+
+        /**
+         *
+         * Search every regular file under directory for _needle, files are memory mapped and scanned
+         * on a worker pool, nothing is copied into profiles. candidates are located with memchr on
+         * the needle first byte(vectorized by libc) and verified in place. matches are streamed to
+         * _on_match one at a time(calls are serialized), return false from it to stop the search.
+         * @param StringView_t& the directory to search
+         * @param StringView_t& the literal to look for
+         * @param contentMatchCallback_t& receives path, offset, line number and line of each match
+         * @param stContentSearchOptions& optional! recursion, per file match limit, worker count
+         * @returns std::size_t number of matches delivered to _on_match
+         *
+         */
+        __0x_attr_FSC_scnt std::size_t SearchDirectoryContent(const StringView_t &directory, const StringView_t &_needle, const contentMatchCallback_t &_on_match, const stContentSearchOptions &_options = {})
+        {
+            if (directory.empty() || _needle.empty() || !_on_match || !IsDirectory(directory))
+                return 0;
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::CONTENT_SEARCH);
+
+            stContentSearchState search_state{.needle = _needle, .on_match = _on_match, .max_matches_per_file = _options.max_matches_per_file};
+            FSWorkStealingPool worker_pool(_options.worker_count);
+
+            auto search_batch = [this, &search_state](const std::vector<String_t> &_batch)
+            {
+                for (const String_t &file_path : _batch)
+                {
+                    if (search_state.stop.load(std::memory_order_relaxed))
+                        return;
+                    try
+                    {
+                        const stMappedFileView file_view(this->__mapFileView(file_path, eMapAdvice::SEQUENTIAL));
+                        if (!file_view.Empty())
+                            __searchContent(file_path, file_view.View(), search_state);
+                    }
+                    catch (const std::runtime_error &)
+                    {
+                        continue;
+                    }
+                }
+            };
+
+            std::vector<String_t> file_batch;
+            /* declared after search_batch and file_batch, so pending searches are drained before either goes away */
+            FSTaskGroup task_group(worker_pool);
+            FSDirectoryWalker::Walk(directory, stWalkOptions{.recursive = _options.recursive, .skip_errors = true}, [&](const stWalkEntry &d_entry)
+                                    {
+                if (search_state.stop.load(std::memory_order_relaxed))
+                    return eWalkAction::STOP;
+                if (d_entry.type != eDirEntryType::DIRECTORY && d_entry.ResolvedType() == eDirEntryType::REGULAR)
+                {
+                    file_batch.emplace_back(d_entry.path);
+                    if (file_batch.size() >= FS_PARALLEL_READ_BATCH)
+                    {
+                        task_group.Run([&search_batch, batch = std::move(file_batch)]
+                                       { search_batch(batch); });
+                        file_batch.clear();
+                    }
+                }
+                return eWalkAction::CONTINUE; });
+            if (!file_batch.empty())
+                task_group.Run([&search_batch, batch = std::move(file_batch)]
+                               { search_batch(batch); });
+            task_group.Wait();
+            return search_state.match_count.load();
+        };
+
+        /**
+         *
+         * Search the content of every registered profile for _needle, see SearchDirectoryContent,
+         * profile contents are searched in place through their handles.
+         * @param StringView_t& the literal to look for
+         * @param contentMatchCallback_t& receives file name, offset, line number and line of each match
+         * @param stContentSearchOptions& optional! per profile match limit, worker count
+         * @returns std::size_t number of matches delivered to _on_match
+         *
+         */
+        __0x_attr_FSC_scnt std::size_t SearchRegisterContent(const StringView_t &_needle, const contentMatchCallback_t &_on_match, const stContentSearchOptions &_options = {})
+        {
+            if (_needle.empty() || !_on_match)
+                return 0;
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::CONTENT_SEARCH);
+
+            const std::vector<ProfileHandle_t> profile_handles(this->_profile_stack_reg.Handles());
+            stContentSearchState search_state{.needle = _needle, .on_match = _on_match, .max_matches_per_file = _options.max_matches_per_file};
+            FSWorkStealingPool worker_pool(_options.worker_count);
+            FSTaskGroup task_group(worker_pool);
+            for (std::size_t batch_begin = 0; batch_begin < profile_handles.size(); batch_begin += FS_PARALLEL_READ_BATCH)
+            {
+                const std::size_t batch_end(std::min(profile_handles.size(), batch_begin + FS_PARALLEL_READ_BATCH));
+                task_group.Run([&profile_handles, &search_state, batch_begin, batch_end]
+                               {
+                    for (std::size_t i = batch_begin; i < batch_end && !search_state.stop.load(std::memory_order_relaxed); ++i)
+                        __searchContent(profile_handles[i]->file_name, profile_handles[i]->Content(), search_state); });
+            }
+            task_group.Wait();
+            return search_state.match_count.load();
+        };
+
+        /**
+         *
+         * Calculate directory size, calculcating size of each entry recursivelly if found another
+         * directory to scan, this can take longer depending on the target directory to scan, if
+         * target to calculate size of is large, use GetDirectorySizeDetachHandler() which is a faster
+         * version allocating detached thread execution handler to each sector depending on S(t).
+         *
+         * @param StringView_t& RO reference to directory target
+         *  @returns std::size_t the calculated size
+         *
+         */
+        inline std::size_t GetDirectorySize(const StringView_t &_directory)
+        {
+            if (_directory.empty())
+                return 0;
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::DIRECTORY_SIZE);
+
+            std::size_t t_size(0);
+
+            if (IsDirectory(_directory))
+            {
+                FSDirectoryWalker::Walk(_directory, stWalkOptions{}, [&t_size](const stWalkEntry &d_entry)
+                                        {
+                    struct stat entry_stat;
+                    if ((d_entry.type == eDirEntryType::REGULAR || d_entry.type == eDirEntryType::SYMLINK) && d_entry.Stat(entry_stat, true) && S_ISREG(entry_stat.st_mode))
+                        t_size += static_cast<std::size_t>(entry_stat.st_size); });
+            }
+            return t_size;
+        };
+
+        /**
+         *
+         * Parallel version of GetDirectorySize, every directory is expanded as its own task on a
+         * work-stealing pool and entries are sized with a minimal statx mask, see
+         * stDirectorySizeOptions for apparent/allocated size, hard link deduplication and mount
+         * point handling. unreadable directories are skipped.
+         * @param StringView_t& RO reference to directory target
+         * @param stDirectorySizeOptions& optional! sizing options
+         * @returns std::size_t the calculated size of regular files under _directory
+         *
+         */
+        __0x_attr_FSC_dszdh std::size_t GetDirectorySizeDetachHandler(const StringView_t &_directory, const stDirectorySizeOptions &_options = {})
+        {
+            if (_directory.empty() || !IsDirectory(_directory))
+                return 0;
+            FSWorkStealingPool worker_pool(_options.worker_count);
+            return __directorySizeParallel(_directory, _options, worker_pool, nullptr);
+        };
+
+        /**
+         *
+         * Async FileRead, the file is streamed in chunks on the shared FSAsyncExecutor, cancellation
+         * is checked between chunks. the controller must outlive the operation.
+         * @param String_t the absolute file path to read
+         * @param stAsyncOptions optional! cancellation token and progress callback(bytes)
+         * @returns std::future<String_t> the file content, rethrows read errors or FSOperationCancelled
+         *
+         */
+        __0x_attr_FSC_asyncf std::future<String_t> FileReadAsync(String_t _file_name, stAsyncOptions _options = {})
+        {
+            return this->__submitAsync<String_t>(this->__fileReadAsyncWork(std::move(_file_name)), std::move(_options));
+        };
+
+        /**
+         *
+         * FileReadAsync, _on_complete receives the ready future on an executor worker.
+         * @param String_t the absolute file path to read
+         * @param asyncCallback_t<String_t> completion callback
+         * @param stAsyncOptions optional! cancellation token and progress callback(bytes)
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_asyncc void FileReadAsync(String_t _file_name, asyncCallback_t<String_t> _on_complete, stAsyncOptions _options = {})
         {
-            if (_new_profile.file_size > 0) [[likely]]
-            {
-                std::lock_guard<std::mutex> _lock(this->_mtx_guard);
-                this->_profile_stack_reg.createProfile(move_src ? std::move(_new_profile) : _new_profile);
-                if (move_src)
-                {
-                    _new_profile = {};
-                }
-            }
+            this->__submitAsync<String_t>(this->__fileReadAsyncWork(std::move(_file_name)), std::move(_options), std::move(_on_complete));
         };
 
         /**
          *
-         * Register new Profile(bulk mode), propagate _new_profile entries into local register.
-         * @param std::unordered_map<struct stFileDescriptor> profile entries to allocate
-         * @param bool if true, source will be moved into destination
+         * Async FileWrite, _buffer is owned by the operation until it completes. the controller must
+         * outlive the operation.
+         * @param String_t the absolute file path to write
+         * @param String_t the content to write
+         * @param bool optional! create the file if it does not exist
+         * @param stAsyncOptions optional! cancellation token(checked before writing) and progress callback(bytes)
+         * @returns std::future<void> ready once written, rethrows write errors or FSOperationCancelled
+         *
+         */
+        __0x_attr_FSC_asyncf std::future<void> FileWriteAsync(String_t _file_name, String_t _buffer, const bool _create_new = false, stAsyncOptions _options = {})
+        {
+            return this->__submitAsync<void>(this->__fileWriteAsyncWork(std::move(_file_name), std::move(_buffer), _create_new), std::move(_options));
+        };
+
+        /**
+         *
+         * FileWriteAsync, _on_complete receives the ready future on an executor worker.
+         * @param String_t the absolute file path to write
+         * @param String_t the content to write
+         * @param asyncCallback_t<void> completion callback
+         * @param bool optional! create the file if it does not exist
+         * @param stAsyncOptions optional! cancellation token(checked before writing) and progress callback(bytes)
          * @returns void
          *
          */
-        __0x_attr_FSC_rnp inline void RegisterNewProfile(std::unordered_map<String_t, struct stFileDescriptor> &_new_profile, const bool move_src = false) noexcept
+        __0x_attr_FSC_asyncc void FileWriteAsync(String_t _file_name, String_t _buffer, asyncCallback_t<void> _on_complete, const bool _create_new = false, stAsyncOptions _options = {})
         {
-            if (_new_profile.size() > 0) [[likely]]
-            {
-                std::lock_guard<std::mutex> _lock(this->_mtx_guard);
-                for (const auto &[fk, descriptor] : _new_profile)
-                {
-                    if (descriptor.file_size <= 0)
-                        continue;
-                    this->_profile_stack_reg.createProfile(move_src ? std::move(descriptor) : descriptor);
-                }
-                if (move_src)
-                {
-                    for (auto &src : _new_profile)
-                        src.second.Clean();
-                    _new_profile.erase(_new_profile.begin(), _new_profile.end());
-                }
-            }
+            this->__submitAsync<void>(this->__fileWriteAsyncWork(std::move(_file_name), std::move(_buffer), _create_new), std::move(_options), std::move(_on_complete));
         };
 
         /**
          *
-         * Register new Profile(bulk mode), propagate _new_profile entries into local register.
-         * @param std::vector<struct stFileDescriptor> profile entries to allocate
-         * @param bool if true, source will be moved into destination
+         * Async DirectoryProfiler, the walk and the file batches run on the shared FSAsyncExecutor
+         * pool, cancellation is checked per file. the controller must outlive the operation.
+         * @param String_t the absolute directory path
+         * @param stAsyncOptions optional! cancellation token and progress callback(files)
+         * @returns std::future<directoryScanResult_t> the aggregation, rethrows errors or FSOperationCancelled
+         *
+         */
+        __0x_attr_FSC_asyncf std::future<directoryScanResult_t> DirectoryProfilerAsync(String_t _path, stAsyncOptions _options = {})
+        {
+            return this->__submitAsync<directoryScanResult_t>(this->__directoryProfilerAsyncWork(std::move(_path)), std::move(_options));
+        };
+
+        /**
+         *
+         * DirectoryProfilerAsync, _on_complete receives the ready future on an executor worker.
+         * @param String_t the absolute directory path
+         * @param asyncCallback_t<directoryScanResult_t> completion callback
+         * @param stAsyncOptions optional! cancellation token and progress callback(files)
          * @returns void
          *
          */
-        __0x_attr_FSC_rnp inline void RegisterNewProfile(std::vector<struct stFileDescriptor> &_new_profile, const bool move_src) noexcept
+        __0x_attr_FSC_asyncc void DirectoryProfilerAsync(String_t _path, asyncCallback_t<directoryScanResult_t> _on_complete, stAsyncOptions _options = {})
         {
-            if (_new_profile.size() > 0) [[likely]]
+            this->__submitAsync<directoryScanResult_t>(this->__directoryProfilerAsyncWork(std::move(_path)), std::move(_options), std::move(_on_complete));
+        };
+
+        /**
+         *
+         * Async CreateDirectoryBackupIncremental, copies run on the shared FSAsyncExecutor pool(the
+         * worker_count option is ignored), cancellation is checked per file and files already copied
+         * are kept. the controller must outlive the operation.
+         * @param String_t the source directory to copy
+         * @param String_t the destination backup directory
+         * @param stBackupOptions optional! incremental mode, directory creation, empty files
+         * @param stAsyncOptions optional! cancellation token and progress callback(files)
+         * @returns std::future<stBackupReport> the backup report, rethrows FSOperationCancelled
+         *
+         */
+        __0x_attr_FSC_asyncf std::future<stBackupReport> CreateDirectoryBackupAsync(String_t dir_source, String_t dir_dest, stBackupOptions _backup_options = {}, stAsyncOptions _options = {})
+        {
+            return this->__submitAsync<stBackupReport>(this->__directoryBackupAsyncWork(std::move(dir_source), std::move(dir_dest), _backup_options), std::move(_options));
+        };
+
+        /**
+         *
+         * CreateDirectoryBackupAsync, _on_complete receives the ready future on an executor worker.
+         * @param String_t the source directory to copy
+         * @param String_t the destination backup directory
+         * @param asyncCallback_t<stBackupReport> completion callback
+         * @param stBackupOptions optional! incremental mode, directory creation, empty files
+         * @param stAsyncOptions optional! cancellation token and progress callback(files)
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_asyncc void CreateDirectoryBackupAsync(String_t dir_source, String_t dir_dest, asyncCallback_t<stBackupReport> _on_complete, stBackupOptions _backup_options = {}, stAsyncOptions _options = {})
+        {
+            this->__submitAsync<stBackupReport>(this->__directoryBackupAsyncWork(std::move(dir_source), std::move(dir_dest), _backup_options), std::move(_options), std::move(_on_complete));
+        };
+
+        /**
+         *
+         * Async GetDirectorySizeDetachHandler on the shared FSAsyncExecutor pool(the worker_count
+         * option is ignored), cancellation is checked per directory.
+         * @param String_t the directory to size
+         * @param stDirectorySizeOptions optional! sizing options
+         * @param stAsyncOptions optional! cancellation token and progress callback(directories)
+         * @returns std::future<std::size_t> the size, 0 for anything but a directory, rethrows FSOperationCancelled
+         *
+         */
+        __0x_attr_FSC_asyncf std::future<std::size_t> GetDirectorySizeAsync(String_t _directory, stDirectorySizeOptions _size_options = {}, stAsyncOptions _options = {})
+        {
+            return this->__submitAsync<std::size_t>(__directorySizeAsyncWork(std::move(_directory), _size_options), std::move(_options));
+        };
+
+        /**
+         *
+         * GetDirectorySizeAsync, _on_complete receives the ready future on an executor worker.
+         * @param String_t the directory to size
+         * @param asyncCallback_t<std::size_t> completion callback
+         * @param stDirectorySizeOptions optional! sizing options
+         * @param stAsyncOptions optional! cancellation token and progress callback(directories)
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_asyncc void GetDirectorySizeAsync(String_t _directory, asyncCallback_t<std::size_t> _on_complete, stDirectorySizeOptions _size_options = {}, stAsyncOptions _options = {})
+        {
+            this->__submitAsync<std::size_t>(__directorySizeAsyncWork(std::move(_directory), _size_options), std::move(_options), std::move(_on_complete));
+        };
+
+#if defined(FS_HAS_COROUTINES)
+        /*
+         * the *Await overloads below stand in for default arguments, GCC 12 destroys class type
+         * default arguments of a co_await operand twice.
+         */
+
+        /**
+         *
+         * Awaitable FileReadAsync, nothing is read until co_await, the coroutine resumes on the
+         * executor worker that completed the read. the controller must outlive the operation.
+         * @param String_t the absolute file path to read
+         * @param stAsyncOptions cancellation token and progress callback(bytes)
+         * @returns FSOperationAwaitable<String_t> co_await yields the file content
+         *
+         */
+        __0x_attr_FSC_asynca FSOperationAwaitable<String_t> FileReadAwait(String_t _file_name, stAsyncOptions _options)
+        {
+            return __awaitAsync<String_t>(this->__fileReadAsyncWork(std::move(_file_name)), std::move(_options));
+        };
+
+        __0x_attr_FSC_asynca FSOperationAwaitable<String_t> FileReadAwait(String_t _file_name)
+        {
+            return this->FileReadAwait(std::move(_file_name), stAsyncOptions{});
+        };
+
+        /**
+         *
+         * Awaitable FileWriteAsync, nothing is written until co_await.
+         * @param String_t the absolute file path to write
+         * @param String_t the content to write
+         * @param bool create the file if it does not exist
+         * @param stAsyncOptions cancellation token(checked before writing) and progress callback(bytes)
+         * @returns FSOperationAwaitable<void> co_await completes once written
+         *
+         */
+        __0x_attr_FSC_asynca FSOperationAwaitable<void> FileWriteAwait(String_t _file_name, String_t _buffer, const bool _create_new, stAsyncOptions _options)
+        {
+            return __awaitAsync<void>(this->__fileWriteAsyncWork(std::move(_file_name), std::move(_buffer), _create_new), std::move(_options));
+        };
+
+        __0x_attr_FSC_asynca FSOperationAwaitable<void> FileWriteAwait(String_t _file_name, String_t _buffer, const bool _create_new = false)
+        {
+            return this->FileWriteAwait(std::move(_file_name), std::move(_buffer), _create_new, stAsyncOptions{});
+        };
+
+        /**
+         *
+         * Awaitable DirectoryProfilerAsync, the walk starts on co_await.
+         * @param String_t the absolute directory path
+         * @param stAsyncOptions cancellation token and progress callback(files)
+         * @returns FSOperationAwaitable<directoryScanResult_t> co_await yields the aggregation
+         *
+         */
+        __0x_attr_FSC_asynca FSOperationAwaitable<directoryScanResult_t> DirectoryProfilerAwait(String_t _path, stAsyncOptions _options)
+        {
+            return __awaitAsync<directoryScanResult_t>(this->__directoryProfilerAsyncWork(std::move(_path)), std::move(_options));
+        };
+
+        __0x_attr_FSC_asynca FSOperationAwaitable<directoryScanResult_t> DirectoryProfilerAwait(String_t _path)
+        {
+            return this->DirectoryProfilerAwait(std::move(_path), stAsyncOptions{});
+        };
+
+        /**
+         *
+         * Awaitable CreateDirectoryBackupAsync, copies start on co_await.
+         * @param String_t the source directory to copy
+         * @param String_t the destination backup directory
+         * @param stBackupOptions incremental mode, directory creation, empty files
+         * @param stAsyncOptions cancellation token and progress callback(files)
+         * @returns FSOperationAwaitable<stBackupReport> co_await yields the backup report
+         *
+         */
+        __0x_attr_FSC_asynca FSOperationAwaitable<stBackupReport> CreateDirectoryBackupAwait(String_t dir_source, String_t dir_dest, stBackupOptions _backup_options, stAsyncOptions _options)
+        {
+            return __awaitAsync<stBackupReport>(this->__directoryBackupAsyncWork(std::move(dir_source), std::move(dir_dest), _backup_options), std::move(_options));
+        };
+
+        __0x_attr_FSC_asynca FSOperationAwaitable<stBackupReport> CreateDirectoryBackupAwait(String_t dir_source, String_t dir_dest, stBackupOptions _backup_options)
+        {
+            return this->CreateDirectoryBackupAwait(std::move(dir_source), std::move(dir_dest), _backup_options, stAsyncOptions{});
+        };
+
+        /**
+         *
+         * Awaitable GetDirectorySizeAsync, sizing starts on co_await.
+         * @param String_t the directory to size
+         * @param stDirectorySizeOptions sizing options
+         * @param stAsyncOptions cancellation token and progress callback(directories)
+         * @returns FSOperationAwaitable<std::size_t> co_await yields the size
+         *
+         */
+        __0x_attr_FSC_asynca FSOperationAwaitable<std::size_t> GetDirectorySizeAwait(String_t _directory, stDirectorySizeOptions _size_options, stAsyncOptions _options)
+        {
+            return __awaitAsync<std::size_t>(__directorySizeAsyncWork(std::move(_directory), _size_options), std::move(_options));
+        };
+
+        __0x_attr_FSC_asynca FSOperationAwaitable<std::size_t> GetDirectorySizeAwait(String_t _directory, stDirectorySizeOptions _size_options)
+        {
+            return this->GetDirectorySizeAwait(std::move(_directory), _size_options, stAsyncOptions{});
+        };
+
+        __0x_attr_FSC_asynca FSOperationAwaitable<std::size_t> GetDirectorySizeAwait(String_t _directory)
+        {
+            return this->GetDirectorySizeAwait(std::move(_directory), stDirectorySizeOptions{}, stAsyncOptions{});
+        };
+#endif
+
+        inline ~FSController() noexcept
+        {
+            if (this->_fs_new_instance) [[likely]]
+                this->_fs_new_instance = false;
+        };
+
+    private:
+        /**
+         *
+         * initialize object, either copy or move from _o depending on _tN value, template
+         * requires _tN class type.
+         * @param _tN the object to move/copy
+         * @returns FSController the pointer to this object
+         *
+         */
+        template <typename _tN, typename = std::enable_if<std::is_class_v<_tN>>>
+        __0x_attr_FSC_ifc inline FSController *__initFsController(_tN _o) noexcept
+        {
+            if (*this != _o)
             {
-                std::lock_guard<std::mutex> _lock(this->_mtx_guard);
-                for (std::size_t profile_counter(0); profile_counter < _new_profile.size(); ++profile_counter)
-                {
-                    if (_new_profile[profile_counter].file_size <= 0)
-                        continue;
-                    this->_profile_stack_reg.createProfile(move_src ? std::move(_new_profile[profile_counter]) : _new_profile[profile_counter]);
-                    if(move_src) _new_profile[profile_counter].Clean();
-                }
-                if (move_src)
-                {
-                    _new_profile.erase(_new_profile.begin(), _new_profile.end());
-                }
+                this->_profile_stack_reg = std::is_rvalue_reference_v<_tN> ? std::move(_o._profile_stack_reg) : _o._profile_stack_reg;
+                this->_fs_new_instance = std::is_rvalue_reference_v<_tN> ? std::move(_o._fs_new_instance) : _o._fs_new_instance;
+                this->_fs_instance_uid = std::is_rvalue_reference_v<_tN> ? std::move(_o._fs_instance_uid) : _o._fs_instance_uid;
             }
+            return this;
         };
 
         /**
          *
-         * Get profiler register stack size
-         * @returns std::size_t the size of register
+         * Create a memory map for a file descriptor.
          *
+         * @param int& fileDescriptor The file descriptor to map.
+         * @param off_t& descriptor_size The size of the file descriptor.
+         * @param bool read_mode Whether to open the map in read-only mode (default) or
+         * read-write mode.
+         * @param std::size_t offset_size The offset to the starting position of the map (default
+         * is 0).
+         *
+         * @returns fMap_t The pointer to the mapped memory region.
          */
-        __0x_attr_FSC_gss constexpr std::size_t &GetRegisterSize(void) noexcept
+        __0x_attr_FSC_cpm inline fMap_t __createPointerMap(const int &fileDescriptor, const off_t &descriptor_size, const bool read_mode = true, const std::size_t &offset_size = 0) noexcept
         {
-            std::lock_guard<std::mutex> _lock(this->_mtx_guard);
-            return this->_profile_stack_reg.reg_stack_size;
+            const int proto_map_mode(read_mode ? PROT_READ : PROT_READ | PROT_WRITE);
+            const int map_access_scope(read_mode ? MAP_PRIVATE : MAP_SHARED);
+            const off_t map_offset = read_mode ? 0 : offset_size;
+            return static_cast<fMap_t>(mmap(NULL, descriptor_size, proto_map_mode, map_access_scope, fileDescriptor, (read_mode ? map_offset : offset_size)));
         };
 
         /**
          *
-         * Get Instance UID
-         * @returns std::uint64_t the instance associated uid
+         * Open a file descriptor for the given file name and mode.
          *
+         * @param StringView_t _file_name The name of the file to open.
+         * @param eFileDescriptorMode _mode The mode in which to open the file (read-only or
+         * read-write).
+         *
+         * @returns int The file descriptor.
+         *
+         * @throws std::runtime_error If the file descriptor cannot be opened.
          */
-        __0x_attr_FSC_gci constexpr std::uint64_t &GetFsControllerUID(void) noexcept
+        __0x_attr_FSC_ofd inline int __openFileDescriptor(const StringView_t &_file_name, const eFileDescriptorMode &_mode)
         {
-            return this->_fs_instance_uid;
+            int descriptor_open(_mode == eFileDescriptorMode::READ ? open(_file_name.data(), O_RDONLY) : open(_file_name.data(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR));
+            if (descriptor_open == -1) [[unlikely]]
+                throw std::runtime_error(std::move(String_t("Cannot open file descriptor for file ") + _file_name.data()));
+            return descriptor_open;
         };
 
         /**
          *
-         * Get profiler structure data block at _profile_id index.
-         * @param _ForeignKeyType_& reference to register profiler associated FK assigned at
-         * allocation
-         * @returns stFileDescriptor const struct description(profiler) identified by
-         * _profile_id or empty descriptor if not found
+         * Open _file_name for writing without truncation.
+         *
+         * @param StringView_t _file_name The name of the file to open.
+         * @param bool _append Whether every write lands at the end of file.
          *
+         * @returns int The file descriptor.
+         *
+         * @throws std::runtime_error If the file descriptor cannot be opened.
          */
-        __0x_attr_FSC_gsp inline const struct stFileDescriptor GetProfile(const _ForeignKeyType_ &_profile_id) noexcept
+        inline int __openWriteDescriptor(const StringView_t &_file_name, const bool _append)
         {
-            std::lock_guard<std::mutex> _lock(this->_mtx_guard);
-            return this->_profile_stack_reg.getProfile(_profile_id);
+            const int descriptor_open(open(static_cast<String_t>(_file_name).c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | (_append ? O_APPEND : 0), S_IRUSR | S_IWUSR));
+            if (descriptor_open == -1) [[unlikely]]
+                throw std::runtime_error(std::move(String_t("Cannot open file descriptor for file ") + _file_name.data()));
+            return descriptor_open;
         };
 
         /**
          *
-         * Get read-only internal stack register
-         * @returns stProfilerStackRegister returns the internal register
+         * Write every vector of _io_vectors in order, in batches of IOV_MAX, resuming after short
+         * writes.
+         *
+         * @param int _fd The destination descriptor.
+         * @param std::vector<iovec>& _io_vectors The buffers to write, consumed in place.
+         * @param bool _append Descriptor is in append mode, offsets are ignored.
+         * @param std::size_t _offset File offset for positional writes.
+         *
+         * @returns std::size_t The number of bytes written.
+         *
+         * @throws std::runtime_error If a write fails.
+         */
+        inline std::size_t __writeVectored(const int _fd, std::vector<struct iovec> &_io_vectors, const bool _append, const std::size_t _offset)
+        {
+            std::size_t written_total(0), vector_index(0);
+            while (vector_index < _io_vectors.size())
+            {
+                const int batch_count(static_cast<int>(std::min<std::size_t>(_io_vectors.size() - vector_index, IOV_MAX)));
+                const ssize_t written_bytes(_append ? writev(_fd, &_io_vectors[vector_index], batch_count) : pwritev(_fd, &_io_vectors[vector_index], batch_count, static_cast<off_t>(_offset + written_total)));
+                if (written_bytes < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    throw std::runtime_error(String_t("Cannot write to descriptor: ") + strerror(errno));
+                }
+                written_total += static_cast<std::size_t>(written_bytes);
+                FS_INSTRUMENT_COUNT(eIoCounter::BYTES_WRITTEN, written_bytes);
+                std::size_t consumed(static_cast<std::size_t>(written_bytes));
+                while (vector_index < _io_vectors.size() && consumed >= _io_vectors[vector_index].iov_len)
+                    consumed -= _io_vectors[vector_index++].iov_len;
+                if (consumed > 0)
+                {
+                    _io_vectors[vector_index].iov_base = static_cast<char *>(_io_vectors[vector_index].iov_base) + consumed;
+                    _io_vectors[vector_index].iov_len -= consumed;
+                }
+            }
+            return written_total;
+        };
+
+        /**
+         *
+         * Create a file status structure for the given file descriptor.
+         *
+         * @param int& file_descriptor The file descriptor.
+         *
+         * @returns struct stat The file status structure.
          *
+         * @throws std::runtime_error If the file status cannot be obtained.
          */
-        __0x_attr_FSC_gsptr inline const struct stProfilerStackRegister GetStackPointer(void) noexcept
+        __0x_attr_FSC_cfs inline struct stat __createFileStat(int &file_descriptor)
         {
-            std::lock_guard<std::mutex> _lock(this->_mtx_guard);
-            return this->_profile_stack_reg;
+            struct stat file_stat_description;
+            if (fstat(file_descriptor, &file_stat_description) == -1) [[unlikely]]
+                throw std::runtime_error(String_t("Error getting file stat") + strerror(errno));
+            return file_stat_description;
         };
 
         /**
          *
-         * delete a profile identified by _profile_id aka FK
-         * @param _ForeignKeyType_& reference to register profiler associated FK
-         * @param bool if true, will unlink globally, meaning the actual file will be removed
-         * @returns void
+         * Verify the state of a memory map.
+         *
+         * @param fMap_t& map_ptr The pointer to the mapped memory region.
          *
+         * @throws std::runtime_error If the memory map is invalid.
          */
-        __0x_attr_FSC_dprf inline void DeleteProfile(const _ForeignKeyType_ &_profile_id) noexcept
+        __0x_attr_FSC_vms inline void __verifyMemMapState(const fMap_t &map_ptr)
         {
-            std::lock_guard<std::mutex> _lock(this->_mtx_guard);
-            this->_profile_stack_reg.eraseProfile(_profile_id);
+            if (map_ptr == MAP_FAILED) [[unlikely]]
+                throw std::runtime_error(String_t("Error mapping file: ") + strerror(errno));
         };
 
         /**
          *
-         * Create _file_name.
-         * @param StringView_t the absolute path to _file_name
-         * @param StringView_t content to write into the file, defaults to nothing
-         * @returns bool if created, true
+         * Open _file_name, map its full content read-only and close the descriptor, the mapping
+         * stays valid after close.
          *
+         * @param StringView_t _file_name The name of the file to map.
+         * @param eMapAdvice _advice Access pattern hint for the mapping.
+         *
+         * @returns stMappedFileView The owning view, empty if the file is empty.
+         *
+         * @throws std::runtime_error If the file cannot be opened or mapped.
          */
-        __0x_attr_FSC_cfl inline const bool CreateFile(const StringView_t &_file_name,
-
-                                                                                                                                                       const StringView_t &_content = "")
+        __0x_attr_FSC_mfv inline stMappedFileView __mapFileView(const StringView_t &_file_name, const eMapAdvice _advice = eMapAdvice::NORMAL)
         {
-            std::ofstream fileCreate(_file_name.data());
-            if (!fileCreate)
-                throw std::runtime_error(std::move(String_t("File Create: ") + strerror(errno)));
+            int fileDescriptor(this->__openFileDescriptor(_file_name, eFileDescriptorMode::READ));
 
-            if (!_content.empty())
+            struct stat file_stat_description;
+            if (fstat(fileDescriptor, &file_stat_description) == -1) [[unlikely]]
             {
-                fileCreate.write(_content.data(), _content.length());
+                close(fileDescriptor);
+                throw std::runtime_error(String_t("Error getting file stat") + strerror(errno));
             }
-            fileCreate.close();
 
-            return FileExists(_file_name);
-        };
+            if (file_stat_description.st_size <= 0)
+            {
+                close(fileDescriptor);
+                return stMappedFileView(nullptr, 0, _file_name);
+            }
 
-        /**
-         *
-         * Create a directory.
-         * @param StringView_t& directory path to create
-         * @returns bool true if directory was created
-         *
-         */
-        __0x_attr_FSC_cdir inline const bool CreateDirectory(const StringView_t &_directory) noexcept
-        {
-            std::filesystem::create_directories(_directory);
-            return std::filesystem::is_directory(_directory);
+            fMap_t mapped_data_pointer(this->__createPointerMap(fileDescriptor, file_stat_description.st_size, true, 0));
+            FS_INSTRUMENT_COUNT(eIoCounter::MMAP_CALLS, 1);
+            close(fileDescriptor);
+
+            this->__verifyMemMapState(mapped_data_pointer);
+
+            stMappedFileView mapped_view(mapped_data_pointer, static_cast<size_t>(file_stat_description.st_size), _file_name);
+            if (_advice != eMapAdvice::NORMAL)
+                mapped_view.Advise(_advice);
+            return mapped_view;
         };
 
+#if defined(FS_HAS_IO_URING)
         /**
          *
-         * Collect directory entries from _directory, if _recursive is true, it will traverse the entire
-         * directories within _directory.
-         * @param StringView_t& directory to collect from
-         * @param bool optional! if true then recursive traversal
-         * @returns std::vector<String_t> vector containing entries from _directory scan.
+         * io_uring batch reader, every in-flight file owns a slot cycling through
+         * openat+statx -> read(until complete) -> close.
+         *
+         * @param FSReadPlanner& planned paths to read, submitted in planned order
+         * @param batchReadCallback_t& completion callback
+         * @param std::size_t number of slots in flight
          *
+         * @returns bool false if io_uring is unavailable and nothing was read
          */
-        __0x_attr_FSC_cdire const std::vector<String_t> CollectDirectoryEntries(const StringView_t &_directory,
-                                                                                                                                                             const bool _recursive = false)
+        inline const bool __fileReadManyUring(const FSReadPlanner &_read_plan, const batchReadCallback_t &_on_complete, const std::size_t _queue_depth)
         {
-            std::vector<String_t> vector_entries;
-            if (_directory.empty())
-                return {};
-            if (_recursive)
+            enum eSlotOp : std::uint8_t
+            {
+                SLOT_OPEN = 0,
+                SLOT_STATX,
+                SLOT_READ,
+                SLOT_CLOSE
+            };
+            struct stBatchSlot
+            {
+                struct statx file_statx;
+                struct stFileDescriptor descriptor;
+                std::size_t read_offset{0};
+                int fd{-1};
+                std::uint8_t pending_ops{0};
+                bool failed{false};
+            };
+
+            /* declared before the ring, the kernel writes into the slots until every operation completed */
+            std::vector<stBatchSlot> batch_slots;
+            FSUringEngine uring_engine(static_cast<unsigned>(_queue_depth * 2), {IORING_OP_OPENAT, IORING_OP_STATX, IORING_OP_READ, IORING_OP_CLOSE});
+            if (!uring_engine.Ready())
+                return false;
+
+            batch_slots.resize(_queue_depth);
+            std::vector<std::size_t> free_slots;
+            free_slots.reserve(_queue_depth);
+            for (std::size_t s = _queue_depth; s > 0; --s)
+                free_slots.push_back(s - 1);
+
+            std::size_t in_flight_ops(0);
+            auto queue_op = [&uring_engine, &in_flight_ops](const std::size_t _slot, const eSlotOp _op) -> struct io_uring_sqe *
+            {
+                struct io_uring_sqe *sqe(uring_engine.GetSqe());
+                if (sqe == nullptr) [[unlikely]]
+                    throw std::runtime_error("io_uring submission ring overflow");
+                ++in_flight_ops;
+                sqe->opcode = _op == SLOT_OPEN ? IORING_OP_OPENAT : _op == SLOT_STATX ? IORING_OP_STATX
+                                                                 : _op == SLOT_READ    ? IORING_OP_READ
+                                                                                       : IORING_OP_CLOSE;
+                sqe->user_data = (static_cast<std::uint64_t>(_slot) << 8) | _op;
+                return sqe;
+            };
+            auto queue_read = [&](const std::size_t _slot)
+            {
+                stBatchSlot &slot(batch_slots[_slot]);
+                struct io_uring_sqe *sqe(queue_op(_slot, SLOT_READ));
+                sqe->fd = slot.fd;
+                sqe->addr = reinterpret_cast<std::uint64_t>(slot.descriptor.file_content.data() + slot.read_offset);
+                sqe->len = static_cast<std::uint32_t>(std::min<std::size_t>(slot.descriptor.file_size - slot.read_offset, 1u << 30));
+                sqe->off = slot.read_offset;
+            };
+            auto queue_close = [&](const std::size_t _slot)
+            {
+                struct io_uring_sqe *sqe(queue_op(_slot, SLOT_CLOSE));
+                sqe->fd = batch_slots[_slot].fd;
+            };
+            auto finish_slot = [&](const std::size_t _slot)
             {
-                for (const auto &d_entry : std::filesystem::recursive_directory_iterator(_directory))
+                stBatchSlot &slot(batch_slots[_slot]);
+                if (!slot.failed)
                 {
-                    if (std::filesystem::is_regular_file(d_entry.path()))
-                    {
-                        vector_entries.push_back(d_entry.path().string());
-                    }
+                    FS_INSTRUMENT_COUNT(eIoCounter::BYTES_READ, slot.descriptor.file_size);
+                    _on_complete(std::move(slot.descriptor));
                 }
-            }
-            else
+                slot.descriptor = {};
+                free_slots.push_back(_slot);
+            };
+
+            std::size_t next_file(0), active_slots(0);
+            try
             {
-                for (const auto &d_entry : std::filesystem::directory_iterator(_directory))
+                while (true)
                 {
-                    if (std::filesystem::is_regular_file(d_entry.path()))
+                    while (!free_slots.empty() && next_file < _read_plan.Size())
                     {
-                        vector_entries.push_back(d_entry.path().string());
+                        const std::size_t slot_index(free_slots.back());
+                        free_slots.pop_back();
+                        stBatchSlot &slot(batch_slots[slot_index]);
+                        const String_t &file_name(_read_plan[next_file++]);
+                        slot.descriptor = this->__createEmptyProfilerStructure(file_name);
+                        slot.read_offset = 0;
+                        slot.fd = -1;
+                        slot.failed = false;
+                        slot.pending_ops = 2;
+
+                        struct io_uring_sqe *open_sqe(queue_op(slot_index, SLOT_OPEN));
+                        open_sqe->fd = AT_FDCWD;
+                        open_sqe->addr = reinterpret_cast<std::uint64_t>(file_name.c_str());
+                        open_sqe->open_flags = O_RDONLY | O_CLOEXEC;
+
+                        struct io_uring_sqe *statx_sqe(queue_op(slot_index, SLOT_STATX));
+                        statx_sqe->fd = AT_FDCWD;
+                        statx_sqe->addr = reinterpret_cast<std::uint64_t>(file_name.c_str());
+                        statx_sqe->len = STATX_SIZE | STATX_TYPE;
+                        statx_sqe->off = reinterpret_cast<std::uint64_t>(&slot.file_statx);
+                        ++active_slots;
                     }
+                    if (active_slots == 0)
+                        break;
+
+                    const int submit_state(uring_engine.SubmitAndWait(1));
+                    if (submit_state < 0) [[unlikely]]
+                        throw std::runtime_error(String_t("io_uring submit failed: ") + strerror(-submit_state));
+
+                    uring_engine.ReapCompletions([&](const struct io_uring_cqe &_completion)
+                                                 {
+                        --in_flight_ops;
+                        const std::size_t slot_index(static_cast<std::size_t>(_completion.user_data >> 8));
+                        const eSlotOp slot_op(static_cast<eSlotOp>(_completion.user_data & 0xff));
+                        stBatchSlot &slot(batch_slots[slot_index]);
+                        switch (slot_op)
+                        {
+                        case SLOT_OPEN:
+                        case SLOT_STATX:
+                            if (_completion.res < 0)
+                                slot.failed = true;
+                            else if (slot_op == SLOT_OPEN)
+                                slot.fd = _completion.res;
+                            else if (!S_ISREG(slot.file_statx.stx_mode))
+                                slot.failed = true;
+                            if (--slot.pending_ops > 0)
+                                return;
+                            if (slot.fd < 0)
+                            {
+                                --active_slots;
+                                finish_slot(slot_index);
+                                return;
+                            }
+                            if (!slot.failed && slot.file_statx.stx_size > 0)
+                            {
+                                slot.descriptor.file_size = static_cast<size_t>(slot.file_statx.stx_size);
+                                slot.descriptor.file_content.resize(slot.descriptor.file_size);
+                                queue_read(slot_index);
+                                return;
+                            }
+                            queue_close(slot_index);
+                            return;
+                        case SLOT_READ:
+                            if (_completion.res < 0)
+                            {
+                                slot.failed = true;
+                            }
+                            else if (_completion.res == 0)
+                            {
+                                slot.descriptor.file_size = slot.read_offset;
+                                slot.descriptor.file_content.resize(slot.read_offset);
+                            }
+                            else if ((slot.read_offset += static_cast<std::size_t>(_completion.res)) < slot.descriptor.file_size)
+                            {
+                                queue_read(slot_index);
+                                return;
+                            }
+                            queue_close(slot_index);
+                            return;
+                        case SLOT_CLOSE:
+                            slot.fd = -1;
+                            --active_slots;
+                            finish_slot(slot_index);
+                            return;
+                        } });
                 }
             }
-            return vector_entries;
+            catch (...)
+            {
+                /* callback or submission failure, wait for every queued operation before the slot buffers go away */
+                while (in_flight_ops > 0 && uring_engine.SubmitAndWait(1) >= 0)
+                    uring_engine.ReapCompletions([&](const struct io_uring_cqe &_completion)
+                                                 {
+                        --in_flight_ops;
+                        stBatchSlot &slot(batch_slots[static_cast<std::size_t>(_completion.user_data >> 8)]);
+                        const eSlotOp slot_op(static_cast<eSlotOp>(_completion.user_data & 0xff));
+                        if (slot_op == SLOT_OPEN && _completion.res >= 0)
+                            slot.fd = _completion.res;
+                        else if (slot_op == SLOT_CLOSE)
+                            slot.fd = -1; });
+                for (stBatchSlot &slot : batch_slots)
+                    if (slot.fd >= 0)
+                        close(slot.fd);
+                throw;
+            }
+            return true;
         };
+#endif
 
         /**
          *
-         * Collect directory entries if any, constructs an object containing min/max collection entry
-         * size, along with an std::array<string> register containing entry name(path) and a collection
-         * array size.
-         * @param StringView_t& directory to collect and profile
-         * @param bool bit flag mandating recursive iteration or not
-         * @param std::size_t threshold to use for register allocation, if register size do not exceed
-         * or touch the threshold, structure will be deleted and empty block returned.
-         * @returns stDirectoryCollectionStat a structure containing directory profiling information,
-         * register stack, register size, min/max register entry size.
+         * thread pool batch reader, fallback when io_uring is not available, every worker claims
+         * the next planned file and reads it with open/fstat/pread/close, the following files are
+         * hinted to the page cache meanwhile.
          *
+         * @param FSReadPlanner& planned paths to read, claimed in planned order
+         * @param batchReadCallback_t& completion callback
+         * @param std::size_t number of workers
+         *
+         * @returns void
          */
-        inline const stDirectoryCollectionStat CollectDirectoryEntriesWithProfiling(const StringView_t &_directory, const bool _recursive, const std::size_t _threshold = 1)
+        inline void __fileReadManyPooled(const FSReadPlanner &_read_plan, const batchReadCallback_t &_on_complete, const std::size_t _queue_depth)
         {
-            stDirectoryCollectionStat new_collection_stat{.registry{this->CollectDirectoryEntries(_directory, _recursive)}};
-            std::size_t max_size_get(0), min_size_get(0), largest_path_index(0), loop_counter(0);
-            if (new_collection_stat.registry.size() > (std::size_t)0)
+            const std::size_t worker_total(std::min<std::size_t>(_queue_depth, _read_plan.Size()));
+            FSWorkStealingPool worker_pool(worker_total);
+            std::mutex callback_guard;
+            std::atomic<std::size_t> next_position{0};
+            FSTaskGroup task_group(worker_pool);
+            for (std::size_t w = 0; w < worker_total; ++w)
             {
-                for (auto ncs_entry = new_collection_stat.registry.begin(); ncs_entry != new_collection_stat.registry.end(); ncs_entry++)
-                {
-                    ++loop_counter;
-                    if (std::filesystem::file_size(*ncs_entry) > max_size_get)
-                    {
-                        max_size_get = std::filesystem::file_size(*ncs_entry);
-                        largest_path_index = loop_counter - 1;
-                    }
-                    if (std::filesystem::file_size(*ncs_entry) < min_size_get)
+                task_group.Run([this, &_read_plan, &_on_complete, &callback_guard, &next_position]
+                               {
+                    for (std::size_t position(next_position.fetch_add(1, std::memory_order_relaxed)); position < _read_plan.Size(); position = next_position.fetch_add(1, std::memory_order_relaxed))
                     {
-                        min_size_get = std::filesystem::file_size(*ncs_entry);
-                    }
-                }
-                new_collection_stat.min_size = min_size_get;
-                new_collection_stat.max_size = max_size_get;
-                new_collection_stat.registry_size = new_collection_stat.registry.size();
-                new_collection_stat.largest_file_path = new_collection_stat.registry.at(largest_path_index);
-            }
-            if (new_collection_stat.registry_size < _threshold)
-            {
-                new_collection_stat = {};
+                        _read_plan.Advance(position);
+                        const String_t &file_name(_read_plan[position]);
+                        struct stFileDescriptor new_profiler(this->__createEmptyProfilerStructure(file_name));
+                        if (!this->__preadFile(file_name, new_profiler))
+                            continue;
+                        std::lock_guard<std::mutex> _lock(callback_guard);
+                        _on_complete(std::move(new_profiler));
+                    } });
             }
-            return new_collection_stat;
+            task_group.Wait();
         };
 
         /**
          *
-         * Scan directory recursively, aggregate every entry which is a regular file type and return the
-         * aggregation.
-         * @param StringView_t& path to aggregate from
-         * @returns directoryScanResult_t the aggregation
+         * Read the full content of _file_name into _descriptor with positional reads.
          *
+         * @param String_t& the file to read
+         * @param stFileDescriptor& destination descriptor
+         *
+         * @returns bool false if the file cannot be opened or read
          */
-        __0x_attr_FSC_dirprf const directoryScanResult_t DirectoryProfiler(const StringView_t &path)
+        inline const bool __preadFile(const String_t &_file_name, struct stFileDescriptor &_descriptor) noexcept
         {
-            directoryScanResult_t scan_result;
-
-            if (path.empty())
-                return scan_result;
-            if (path.length() < FS_MAX_FILE_NAME_LENGTH)
+            const int file_descriptor(open(_file_name.c_str(), O_RDONLY | O_CLOEXEC));
+            if (file_descriptor == -1)
+                return false;
+            struct stat file_stat_description;
+            if (fstat(file_descriptor, &file_stat_description) == -1 || !S_ISREG(file_stat_description.st_mode))
             {
-                if (!std::filesystem::path(path).is_absolute())
-                    throw std::runtime_error("Use an absolute path please!");
-                this->__recursiveAggregation(path, scan_result);
+                close(file_descriptor);
+                return false;
             }
-            return scan_result;
+            _descriptor.file_size = static_cast<size_t>(file_stat_description.st_size);
+            _descriptor.file_content.resize(_descriptor.file_size);
+            const ssize_t read_bytes(__preadFully(file_descriptor, _descriptor.file_content.data(), _descriptor.file_size, 0));
+            close(file_descriptor);
+            if (read_bytes < 0)
+                return false;
+            _descriptor.file_size = static_cast<size_t>(read_bytes);
+            _descriptor.file_content.resize(_descriptor.file_size);
+            return true;
         };
 
         /**
          *
-         * Delete a file_name, this action is not reversible.
-         * @param StringView_t& path to file to remove
-         * @returns void
+         * Copy _source_path content onto _destination_path(created or truncated), trying a reflink
+         * first, then copy_file_range, then a read/write loop. destination inherits source mode and
+         * timestamps.
+         *
+         * @param String_t& source file
+         * @param String_t& destination file
+         * @param struct stat& source file status
+         * @param bool& set to true when the copy was a reflink
          *
+         * @returns bool false if the copy failed
          */
-        __0x_attr_FSC_delfl inline static void DeleteFile(const StringView_t &file_name)
+        static inline const bool __copyFileContent(const String_t &_source_path, const String_t &_destination_path, const struct stat &_source_stat, bool &_was_cloned) noexcept
         {
-            if (file_name.empty())
-                return;
-            if (FileExists(file_name))
+            const stScopedDescriptor source_descriptor{open(_source_path.c_str(), O_RDONLY | O_CLOEXEC)};
+            if (source_descriptor.fd == -1)
+                return false;
+            const stScopedDescriptor destination_descriptor{open(_destination_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, _source_stat.st_mode & 07777)};
+            if (destination_descriptor.fd == -1)
+                return false;
+
+            const std::size_t copy_size(static_cast<std::size_t>(_source_stat.st_size));
+            std::size_t copied_bytes(0);
+#if defined(__linux__) && defined(FICLONE)
+            if (copy_size > 0 && ioctl(destination_descriptor.fd, FICLONE, source_descriptor.fd) == 0)
             {
-                if (std::filesystem::is_regular_file(file_name))
+                _was_cloned = true;
+                copied_bytes = copy_size;
+            }
+#endif
+#if defined(__linux__)
+            while (copied_bytes < copy_size)
+            {
+                const ssize_t chunk_bytes(copy_file_range(source_descriptor.fd, nullptr, destination_descriptor.fd, nullptr, copy_size - copied_bytes, 0));
+                if (chunk_bytes < 0 && errno == EINTR)
+                    continue;
+                if (chunk_bytes <= 0)
+                    break;
+                copied_bytes += static_cast<std::size_t>(chunk_bytes);
+            }
+#endif
+            if (copied_bytes < copy_size)
+            {
+                std::unique_ptr<char[]> copy_buffer(std::make_unique<char[]>(FS_STREAM_CHUNK_SIZE));
+                while (copied_bytes < copy_size)
                 {
-                    std::filesystem::remove(file_name);
+                    const ssize_t read_bytes(__preadFully(source_descriptor.fd, copy_buffer.get(), std::min<std::size_t>(FS_STREAM_CHUNK_SIZE, copy_size - copied_bytes), copied_bytes));
+                    if (read_bytes <= 0)
+                        return false;
+                    std::size_t written_chunk(0);
+                    while (written_chunk < static_cast<std::size_t>(read_bytes))
+                    {
+                        const ssize_t written_bytes(pwrite(destination_descriptor.fd, copy_buffer.get() + written_chunk, static_cast<std::size_t>(read_bytes) - written_chunk, static_cast<off_t>(copied_bytes + written_chunk)));
+                        if (written_bytes < 0 && errno == EINTR)
+                            continue;
+                        if (written_bytes <= 0)
+                            return false;
+                        written_chunk += static_cast<std::size_t>(written_bytes);
+                    }
+                    copied_bytes += written_chunk;
+                    FS_INSTRUMENT_COUNT(eIoCounter::BYTES_WRITTEN, written_chunk);
                 }
             }
+
+            fchmod(destination_descriptor.fd, _source_stat.st_mode & 07777);
+#if defined(__APPLE__)
+            const struct timespec source_times[2]{_source_stat.st_atimespec, _source_stat.st_mtimespec};
+#else
+            const struct timespec source_times[2]{_source_stat.st_atim, _source_stat.st_mtim};
+#endif
+            return futimens(destination_descriptor.fd, source_times) == 0;
         };
 
         /**
          *
-         * Create a backup copy of dir_source directory as dir_dest, to override existing destination
-         * files set dest_override to true, to copy empty files set copy_empty_files to true.
+         * CreateDirectoryBackupIncremental on _pool, shared by the parallel and async variants.
          * @param StringView_t& the source directory to copy
-         * @param StringView_t dir_dest the destination backup directory
-         * @param bool optional! it true will override existing files
-         * @param bool optional! if true will copy empty files
-         * @returns bool true if backup was successful
+         * @param StringView_t& the destination backup directory
+         * @param stBackupOptions& backup options, worker_count is ignored
+         * @param FSWorkStealingPool& pool running the copies
+         * @param stOperationControl* optional cancellation/progress, progress counts files
+         * @returns stBackupReport copy/skip/failure counters
          *
+         * @throws FSOperationCancelled If _control was cancelled, files copied so far are kept.
          */
-        __0x_attr_FSC_cdbk const bool CreateDirectoryBackup(const StringView_t &dir_source, const StringView_t &dir_dest, const bool create_backup_dir = false, const bool dest_override = false, const bool copy_empty_files = false)
+        inline const stBackupReport __directoryBackupIncremental(const StringView_t &dir_source, const StringView_t &dir_dest, const stBackupOptions &_options, FSWorkStealingPool &_pool, stOperationControl *_control)
         {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::DIRECTORY_BACKUP);
+            stBackupReport backup_report;
             try
             {
-                const bool is_source(IsDirectory(dir_source)), is_destination(IsDirectory(dir_dest));
-
-                if (!is_source)
+                if (!IsDirectory(dir_source))
                     throw std::runtime_error("source directory not valid for backup!");
-                else if(!is_destination && create_backup_dir)    
+                if (!IsDirectory(dir_dest) && _options.create_backup_dir)
                     std::filesystem::create_directories(dir_dest);
-                
-                if (IsDirectory(dir_dest))
+                if (!IsDirectory(dir_dest))
+                    throw std::runtime_error("destination directory not created!");
+
+                std::atomic<std::size_t> files_copied{0}, files_skipped{0}, files_failed{0}, files_cloned{0}, bytes_copied{0};
+                std::size_t unreadable_directories(0);
+                const std::filesystem::path destination_root(dir_dest);
+
+                auto copy_batch = [&](const std::vector<std::pair<String_t, String_t>> &_batch)
                 {
-                    for (const auto &d_entry : std::filesystem::recursive_directory_iterator(dir_source))
+                    for (const auto &[source_path, destination_path] : _batch)
                     {
-                        const std::filesystem::path relative_source_path = std::filesystem::relative(d_entry.path(), dir_source);
-                        const std::filesystem::path destinationPath = std::filesystem::path(dir_dest) / relative_source_path;
-
-                        if (std::filesystem::is_directory(d_entry.status()))
+                        if (_control != nullptr && _control->Cancelled())
+                            return;
+                        if (_control != nullptr)
+                            _control->Advance(1);
+                        struct stat source_stat, destination_stat;
+                        if (stat(source_path.c_str(), &source_stat) == -1 || !S_ISREG(source_stat.st_mode))
                         {
-                            if (!std::filesystem::exists(destinationPath))
-                            {
-                                std::filesystem::create_directories(destinationPath);
-                            }
+                            files_failed.fetch_add(1, std::memory_order_relaxed);
+                            continue;
                         }
-                        else
+                        if (!_options.copy_empty_files && source_stat.st_size <= 0)
+                        {
+                            files_skipped.fetch_add(1, std::memory_order_relaxed);
+                            continue;
+                        }
+                        if (_options.incremental && stat(destination_path.c_str(), &destination_stat) == 0 && destination_stat.st_size == source_stat.st_size &&
+                            destination_stat.st_mtim.tv_sec == source_stat.st_mtim.tv_sec && destination_stat.st_mtim.tv_nsec == source_stat.st_mtim.tv_nsec)
+                        {
+                            files_skipped.fetch_add(1, std::memory_order_relaxed);
+                            continue;
+                        }
+                        bool was_cloned(false);
+                        if (!__copyFileContent(source_path, destination_path, source_stat, was_cloned))
                         {
-                            if (!copy_empty_files && std::filesystem::file_size(d_entry.path()) <= 0)
-                                continue;
-                            std::filesystem::copy_file(d_entry.path(), destinationPath, dest_override ? std::filesystem::copy_options::overwrite_existing : std::filesystem::copy_options::skip_existing);
+                            files_failed.fetch_add(1, std::memory_order_relaxed);
+                            continue;
                         }
+                        files_copied.fetch_add(1, std::memory_order_relaxed);
+                        bytes_copied.fetch_add(static_cast<std::size_t>(source_stat.st_size), std::memory_order_relaxed);
+                        if (was_cloned)
+                            files_cloned.fetch_add(1, std::memory_order_relaxed);
                     }
-                    this->sync_backup_exec_state = this->__directoryBackupVerify(dir_source, dir_dest);
-                }
-                else
-                {
-                    throw std::filesystem::filesystem_error::runtime_error("destination directory not created!");
-                }
-            }
-            catch (const std::exception &e)
-            {
-                std::cerr << "Error: " << e.what() << "\n";
-                this->sync_backup_exec_state = false;
-            }
-            return this->sync_backup_exec_state;
-        };
-
-
-        bool CreateDirectoryBackupJoinExecution(const StringView_t &dir_source, const StringView_t &dir_dest, const bool create_backup_dir = false, const bool dest_override = false, const bool copy_empty_files = false)
-        {
-            this->sync_backup_exec_state = false;
-            std::thread sync_execute([&]{return this->CreateDirectoryBackup(dir_source, dir_dest, create_backup_dir, dest_override, copy_empty_files);});
-            if(sync_execute.joinable()) sync_execute.join();
-            return this->sync_backup_exec_state;
-        };
-
-        /**
-         *
-         * Check if directory contains a specific file type or file name.
-         * @param StringView_t& the directory to scan
-         * @param StringView_t& the file type or file name to lookup
-         * @returns stDirectoryLookup structure containing scan variables
-         *
-         */
-        template <typename _lookupReturnType, typename = std::enable_if_t<std::is_same_v<_lookupReturnType, stDirectoryLookup>>>
-        __0x_attr_FSC_dcft inline const stDirectoryLookup DirectoryContainsFileType(
-            const StringView_t &directory, const StringView_t &s_node, const bool recursive_scan = false)
-        {
-            std::cout << "Used stDirectoryLookup Type!\n";
-            static_assert(std::is_same_v<_lookupReturnType, stDirectoryLookup>, "use stDirectoryLookup for _lookupReturnType");
-            stDirectoryLookup lookup_table;
-
-            if (directory.empty() || s_node.empty() || s_node.length() > FS_MAX_FILE_NAME_LENGTH || directory.size() > FS_MAX_FILE_NAME_LENGTH)
-                return lookup_table;
-
-            std::function<String_t(const StringView_t &path)> split_path = [&](const StringView_t &path)
-            {
-                return path.find("/") != std::string::npos ? static_cast<String_t>(path.substr(path.find_last_of("/") + 1).data()) : String_t("");
-            };
-
-            std::vector<String_t> dir_entries = this->CollectDirectoryEntries(directory, recursive_scan);
-
-            if (dir_entries.size() > 0)
-            {
-                for (std::size_t j = 0; j < dir_entries.size(); ++j)
-                {
-                    lookup_table = {};
-                    if (split_path(static_cast<StringView_t>(dir_entries[j])).find(s_node) != std::string::npos)
+                };
+
+                std::vector<std::pair<String_t, String_t>> file_batch;
+                /* declared after copy_batch and file_batch, so pending copies are drained before either goes away */
+                FSTaskGroup task_group(_pool);
+                /* an unreadable subdirectory is counted as a failure, the rest of the tree is still copied */
+                FSDirectoryWalker::Walk(dir_source, stWalkOptions{.skip_errors = true, .skipped_directories = &unreadable_directories}, [&](const stWalkEntry &d_entry)
+                                        {
+                    if (_control != nullptr && _control->Cancelled())
+                        return eWalkAction::STOP;
+                    const std::filesystem::path destinationPath(destination_root / d_entry.relative);
+                    const eDirEntryType entry_type(d_entry.ResolvedType());
+                    if (entry_type == eDirEntryType::DIRECTORY)
+                    {
+                        std::error_code create_error;
+                        std::filesystem::create_directories(destinationPath, create_error);
+                    }
+                    else if (entry_type == eDirEntryType::REGULAR)
                     {
-                        lookup_table.file = split_path(dir_entries[j]);
-                        if (s_node.find(".") != std::string::npos && lookup_table.file.find(".") == std::string::npos)
+                        if (_control != nullptr)
+                            _control->AddTotal(1);
+                        file_batch.emplace_back(d_entry.path, destinationPath.string());
+                        if (file_batch.size() >= FS_PARALLEL_READ_BATCH)
                         {
-                            lookup_table.file.clear();
+                            task_group.Run([&copy_batch, batch = std::move(file_batch)]
+                                           { copy_batch(batch); });
+                            file_batch.clear();
                         }
-                        lookup_table.path = lookup_table.file.empty() ? "" : dir_entries[j];
-                        if ((lookup_table.has_found = !lookup_table.file.empty()) == true)
-                            break;
                     }
-                }
+                    return eWalkAction::CONTINUE; });
+                if (!file_batch.empty())
+                    task_group.Run([&copy_batch, batch = std::move(file_batch)]
+                                   { copy_batch(batch); });
+                task_group.Wait();
+                if (_control != nullptr)
+                    _control->ThrowIfCancelled();
+
+                backup_report.files_copied = files_copied.load();
+                backup_report.files_skipped = files_skipped.load();
+                backup_report.files_failed = files_failed.load() + unreadable_directories;
+                backup_report.files_cloned = files_cloned.load();
+                backup_report.bytes_copied = bytes_copied.load();
+                backup_report.success = backup_report.files_failed == 0;
             }
-            return lookup_table;
-        };
-
-        /**
-         * 
-         * Wipe Entire directory contents without possibility of reversing the action, remove contents and based on force_empty_folder also empty folders.
-         * @param StringView_t& directory target
-         * @param bool if force the deletion of empty folders...
-         * @returns void
-         * 
-         */
-        __0x_attr_FSC_dirwp inline void DirectoryWipe(const StringView_t &_directory, const bool force_empty_folder)
-        {
-            if (_directory.empty() || !IsDirectory(_directory))
-                return;
-
-            if (force_empty_folder)
+            catch (const FSOperationCancelled &)
             {
-                std::filesystem::remove_all(_directory);
-                return;
+                throw;
             }
-            for (auto &block : std::filesystem::recursive_directory_iterator(_directory))
+            catch (const std::exception &e)
             {
-                if (block.is_directory())
-                {
-                    DirectoryWipe((StringView_t)block.path().string(), force_empty_folder);
-                }
-                else
-                {
-                    std::filesystem::remove(block.path());
-                }
+                std::cerr << "Error: " << e.what() << "\n";
+                backup_report.success = false;
             }
-        };
-
-        /**
-         *
-         * Calculate directory size, calculcating size of each entry recursivelly if found another
-         * directory to scan, this can take longer depending on the target directory to scan, if
-         * target to calculate size of is large, use GetDirectorySizeDetachHandler() which is a faster
-         * version allocating detached thread execution handler to each sector depending on S(t).
+            return backup_report;
+        };
+
+        /**
          *
-         * @param StringView_t& RO reference to directory target
-         *  @returns std::size_t the calculated size
+         * GetDirectorySizeDetachHandler on _pool, shared by the parallel and async variants.
+         * @param StringView_t& directory to size
+         * @param stDirectorySizeOptions& sizing options, worker_count is ignored
+         * @param FSWorkStealingPool& pool running the walk
+         * @param stOperationControl* optional cancellation/progress, progress counts directories
+         * @returns std::size_t the calculated size, 0 if _directory cannot be stat'ed
          *
+         * @throws FSOperationCancelled If _control was cancelled.
          */
-        inline std::size_t GetDirectorySize(const StringView_t &_directory)
+        static std::size_t __directorySizeParallel(const StringView_t &_directory, const stDirectorySizeOptions &_options, FSWorkStealingPool &_pool, stOperationControl *_control)
         {
-            if (_directory.empty())
-                return 0;
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::DIRECTORY_SIZE);
 
-            std::size_t t_size(0);
+            struct stat root_stat;
+            if (stat(static_cast<String_t>(_directory).c_str(), &root_stat) == -1)
+                return 0;
 
-            if (IsDirectory(_directory))
+            stSizeAggregation size_state{.options{_options}, .root_device{static_cast<std::uint64_t>(root_stat.st_dev)}, .control{_control}};
             {
-                for (const auto &d_entry : std::filesystem::recursive_directory_iterator(_directory))
-                {
-                    if (d_entry.is_regular_file())
-                    {
-                        t_size += d_entry.file_size();
-                    }
-                }
+                FSTaskGroup task_group(_pool);
+                __parallelSizeAggregation(static_cast<String_t>(_directory), task_group, size_state);
+                task_group.Wait();
             }
-            return t_size;
+            if (_control != nullptr)
+                _control->ThrowIfCancelled();
+            return size_state.total_size.load();
         };
 
-        inline ~FSController() noexcept
-        {
-            if (this->_fs_new_instance) [[likely]]
-                this->_fs_new_instance = false;
-        };
-
-    private:
         /**
          *
-         * initialize object, either copy or move from _o depending on _tN value, template
-         * requires _tN class type.
-         * @param _tN the object to move/copy
-         * @returns FSController the pointer to this object
+         * Size the entries of _p in a task of _group, subdirectories are submitted as tasks of
+         * their own, the directory total is added to _state once.
+         * @param String_t the directory to size
+         * @param FSTaskGroup& the group running the walk
+         * @param stSizeAggregation& shared sizing state
+         * @returns void
          *
          */
-        template <typename _tN, typename = std::enable_if<std::is_class_v<_tN>>>
-        __0x_attr_FSC_ifc inline FSController *__initFsController(_tN _o) noexcept
+        static void __parallelSizeAggregation(String_t _p, FSTaskGroup &_group, stSizeAggregation &_state)
         {
-            if (*this != _o)
-            {
-                this->_profile_stack_reg = std::is_rvalue_reference_v<_tN> ? std::move(_o._profile_stack_reg) : _o._profile_stack_reg;
-                this->_fs_new_instance = std::is_rvalue_reference_v<_tN> ? std::move(_o._fs_new_instance) : _o._fs_new_instance;
-                this->_fs_instance_uid = std::is_rvalue_reference_v<_tN> ? std::move(_o._fs_instance_uid) : _o._fs_instance_uid;
-            }
-            return this;
+            if (_state.control != nullptr)
+                _state.control->AddTotal(1);
+            _group.Run([_p = std::move(_p), &_group, &_state]
+                       {
+                if (_state.control != nullptr && _state.control->Cancelled())
+                    return;
+                const stDirectorySizeOptions &options(_state.options);
+                const uint32_t size_field(options.allocated_size ? STAT_FIELD_BLOCKS : STAT_FIELD_SIZE);
+                const uint32_t link_fields(options.dedup_hardlinks ? (STAT_FIELD_INODE | STAT_FIELD_NLINK) : 0);
+                std::size_t directory_total(0);
+
+                FSDirectoryWalker::Walk(_p, stWalkOptions{.recursive = false, .skip_errors = true}, [&](const stWalkEntry &dir_entry)
+                                        {
+                    stEntryStat entry_stat;
+                    eDirEntryType entry_type(dir_entry.type);
+                    if (entry_type == eDirEntryType::UNKNOWN)
+                    {
+                        if (!dir_entry.StatFields(entry_stat, STAT_FIELD_TYPE))
+                            return;
+                        entry_type = stWalkEntry::ModeToType(entry_stat.mode);
+                    }
+
+                    if (entry_type == eDirEntryType::DIRECTORY)
+                    {
+                        if (options.same_filesystem && (!dir_entry.StatFields(entry_stat, STAT_FIELD_TYPE) || entry_stat.device != _state.root_device))
+                            return;
+                        __parallelSizeAggregation(static_cast<String_t>(dir_entry.path), _group, _state);
+                        return;
+                    }
+                    if (entry_type != eDirEntryType::REGULAR && (entry_type != eDirEntryType::SYMLINK || !options.follow_symlinks))
+                        return;
+                    if (!dir_entry.StatFields(entry_stat, STAT_FIELD_TYPE | size_field | link_fields, true) || !S_ISREG(entry_stat.mode))
+                        return;
+                    if (options.dedup_hardlinks && entry_stat.nlink > 1 && !_state.visited_inodes.Insert(entry_stat.device, entry_stat.inode))
+                        return;
+                    directory_total += options.allocated_size ? static_cast<std::size_t>(entry_stat.blocks) * 512 : static_cast<std::size_t>(entry_stat.size); });
+
+                _state.total_size.fetch_add(directory_total, std::memory_order_relaxed);
+                if (_state.control != nullptr)
+                    _state.control->Advance(1); });
         };
 
         /**
          *
-         * Create a memory map for a file descriptor.
-         *
-         * @param int& fileDescriptor The file descriptor to map.
-         * @param off_t& descriptor_size The size of the file descriptor.
-         * @param bool read_mode Whether to open the map in read-only mode (default) or
-         * read-write mode.
-         * @param std::size_t offset_size The offset to the starting position of the map (default
-         * is 0).
-         *
-         * @returns fMap_t The pointer to the mapped memory region.
+         * Collect and profile the regular files of _p as a task of _group, subdirectories become
+         * their own tasks when recursive. the task gathers paths, sizes, histogram and extension
+         * totals locally and merges them into _state once.
+         * @param String_t directory to collect
+         * @param FSTaskGroup& group the task(and its subtasks) run on
+         * @param stCollectionAggregation& shared collection state
+         * @returns void
          */
-        __0x_attr_FSC_cpm inline fMap_t __createPointerMap(const int &fileDescriptor, const off_t &descriptor_size, const bool read_mode = true, const std::size_t &offset_size = 0) noexcept
+        static void __parallelCollection(String_t _p, FSTaskGroup &_group, stCollectionAggregation &_state)
         {
-            const int proto_map_mode(read_mode ? PROT_READ : PROT_READ | PROT_WRITE);
-            const int map_access_scope(read_mode ? MAP_PRIVATE : MAP_SHARED);
-            const off_t map_offset = read_mode ? 0 : offset_size;
-            return static_cast<fMap_t>(mmap(NULL, descriptor_size, proto_map_mode, map_access_scope, fileDescriptor, (read_mode ? map_offset : offset_size)));
+            _group.Run([_p = std::move(_p), &_group, &_state]
+                       {
+                stDirectoryCollectionStat local_stat{.min_size{std::numeric_limits<std::size_t>::max()}};
+                std::vector<std::size_t> local_sizes;
+
+                FSDirectoryWalker::Walk(_p, stWalkOptions{.recursive = false, .skip_errors = true}, [&](const stWalkEntry &dir_entry)
+                                        {
+                    stEntryStat entry_stat;
+                    eDirEntryType entry_type(dir_entry.type);
+                    if (entry_type == eDirEntryType::UNKNOWN)
+                    {
+                        if (!dir_entry.StatFields(entry_stat, STAT_FIELD_TYPE | STAT_FIELD_SIZE | STAT_FIELD_MTIME))
+                            return;
+                        entry_type = stWalkEntry::ModeToType(entry_stat.mode);
+                    }
+                    if (entry_type == eDirEntryType::DIRECTORY)
+                    {
+                        if (_state.recursive)
+                            __parallelCollection(static_cast<String_t>(dir_entry.path), _group, _state);
+                        return;
+                    }
+                    if (entry_type == eDirEntryType::SYMLINK || (entry_type == eDirEntryType::REGULAR && dir_entry.type != eDirEntryType::UNKNOWN))
+                    {
+                        if (!dir_entry.StatFields(entry_stat, STAT_FIELD_TYPE | STAT_FIELD_SIZE | STAT_FIELD_MTIME, true))
+                            return;
+                    }
+                    else if (entry_type != eDirEntryType::REGULAR)
+                    {
+                        return;
+                    }
+                    if (!S_ISREG(entry_stat.mode))
+                        return;
+
+                    const std::size_t entry_size(static_cast<std::size_t>(entry_stat.size));
+                    local_stat.registry.emplace_back(dir_entry.path);
+                    local_sizes.push_back(entry_size);
+                    local_stat.total_size += entry_size;
+                    local_stat.min_size = std::min(local_stat.min_size, entry_size);
+                    if (entry_size > local_stat.max_size || local_stat.largest_file_path.empty() || (entry_size == local_stat.max_size && dir_entry.path < local_stat.largest_file_path))
+                    {
+                        local_stat.max_size = entry_size;
+                        local_stat.largest_file_path = dir_entry.path;
+                    }
+                    if (local_stat.newest_file_path.empty() || __timespecAfter(entry_stat.mtime, local_stat.newest_mtime) ||
+                        (!__timespecAfter(local_stat.newest_mtime, entry_stat.mtime) && dir_entry.path < local_stat.newest_file_path))
+                    {
+                        local_stat.newest_mtime = entry_stat.mtime;
+                        local_stat.newest_file_path = dir_entry.path;
+                    }
+                    ++local_stat.size_histogram[BitWidth64(static_cast<std::uint64_t>(entry_size))];
+
+                    const std::size_t extension_dot(dir_entry.name.rfind('.'));
+                    const StringView_t extension(extension_dot == StringView_t::npos || extension_dot == 0 ? StringView_t() : dir_entry.name.substr(extension_dot));
+                    stExtensionTotals &extension_totals(local_stat.extension_totals[String_t(extension)]);
+                    ++extension_totals.files;
+                    extension_totals.bytes += entry_size; });
+
+                if (local_stat.registry.empty())
+                    return;
+                std::lock_guard<std::mutex> _lock(_state.merge_guard);
+                stDirectoryCollectionStat &result(_state.result);
+                result.registry.insert(result.registry.end(), std::make_move_iterator(local_stat.registry.begin()), std::make_move_iterator(local_stat.registry.end()));
+                _state.sizes.insert(_state.sizes.end(), local_sizes.begin(), local_sizes.end());
+                result.total_size += local_stat.total_size;
+                result.min_size = std::min(result.min_size, local_stat.min_size);
+                if (local_stat.max_size > result.max_size || result.largest_file_path.empty() || (local_stat.max_size == result.max_size && local_stat.largest_file_path < result.largest_file_path))
+                {
+                    result.max_size = local_stat.max_size;
+                    result.largest_file_path = std::move(local_stat.largest_file_path);
+                }
+                if (result.newest_file_path.empty() || __timespecAfter(local_stat.newest_mtime, result.newest_mtime) ||
+                    (!__timespecAfter(result.newest_mtime, local_stat.newest_mtime) && local_stat.newest_file_path < result.newest_file_path))
+                {
+                    result.newest_mtime = local_stat.newest_mtime;
+                    result.newest_file_path = std::move(local_stat.newest_file_path);
+                }
+                for (std::size_t h = 0; h < result.size_histogram.size(); ++h)
+                    result.size_histogram[h] += local_stat.size_histogram[h];
+                for (const auto &[extension, extension_totals] : local_stat.extension_totals)
+                {
+                    stExtensionTotals &merged_totals(result.extension_totals[extension]);
+                    merged_totals.files += extension_totals.files;
+                    merged_totals.bytes += extension_totals.bytes;
+                } });
+        };
+
+        static inline const bool __timespecAfter(const struct timespec &_lhs, const struct timespec &_rhs) noexcept
+        {
+            return _lhs.tv_sec != _rhs.tv_sec ? _lhs.tv_sec > _rhs.tv_sec : _lhs.tv_nsec > _rhs.tv_nsec;
         };
 
         /**
          *
-         * Open a file descriptor for the given file name and mode.
-         *
-         * @param StringView_t _file_name The name of the file to open.
-         * @param eFileDescriptorMode _mode The mode in which to open the file (read-only or
-         * read-write).
-         *
-         * @returns int The file descriptor.
-         *
-         * @throws std::runtime_error If the file descriptor cannot be opened.
+         * Index every regular file(symlinks resolved) under _root by relative path, with the stat
+         * data needed by the verification tiers.
+         * @param StringView_t& the directory to index
+         * @param verifyIndex_t& the index to fill
+         * @returns void
          */
-        __0x_attr_FSC_ofd inline int __openFileDescriptor(const StringView_t &_file_name, const eFileDescriptorMode &_mode)
+        static void __collectVerifyIndex(const StringView_t &_root, verifyIndex_t &_index)
         {
-            int descriptor_open(_mode == eFileDescriptorMode::READ ? open(_file_name.data(), O_RDONLY) : open(_file_name.data(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR));
-            if (descriptor_open == -1) [[unlikely]]
-                throw std::runtime_error(std::move(String_t("Cannot open file descriptor for file ") + _file_name.data()));
-            return descriptor_open;
+            FSDirectoryWalker::Walk(_root, stWalkOptions{}, [&_index](const stWalkEntry &d_entry)
+                                    {
+                struct stat entry_stat;
+                if (d_entry.type != eDirEntryType::REGULAR && d_entry.type != eDirEntryType::SYMLINK && d_entry.type != eDirEntryType::UNKNOWN)
+                    return;
+                if (!d_entry.Stat(entry_stat, true) || !S_ISREG(entry_stat.st_mode))
+                    return;
+                _index.emplace(String_t(d_entry.relative), stVerifyEntry{.path{String_t(d_entry.path)}, .relative_offset{d_entry.path.size() - d_entry.relative.size()}, .size{static_cast<std::size_t>(entry_stat.st_size)}, .mtime{
+#if defined(__APPLE__)
+                    entry_stat.st_mtimespec
+#else
+                    entry_stat.st_mtim
+#endif
+                }}); });
         };
 
         /**
          *
-         * Create a file status structure for the given file descriptor.
-         *
-         * @param int& file_descriptor The file descriptor.
-         *
-         * @returns struct stat The file status structure.
-         *
-         * @throws std::runtime_error If the file status cannot be obtained.
+         * Stream _path through XXH64 using _buffer(FS_STREAM_CHUNK_SIZE bytes).
+         * @param String_t& the file to hash
+         * @param char* scratch buffer
+         * @param std::uint64_t& receives the digest
+         * @returns bool false if the file could not be read
          */
-        __0x_attr_FSC_cfs inline struct stat __createFileStat(int &file_descriptor)
+        __0x_attr_FSC_fhash static const bool __hashFileContent(const String_t &_path, char *_buffer, std::uint64_t &_hash) noexcept
         {
-            struct stat file_stat_description;
-            if (fstat(file_descriptor, &file_stat_description) == -1) [[unlikely]]
-                throw std::runtime_error(String_t("Error getting file stat") + strerror(errno));
-            return file_stat_description;
+            const stScopedDescriptor file_descriptor{open(_path.c_str(), O_RDONLY | O_CLOEXEC)};
+            if (file_descriptor.fd == -1)
+                return false;
+            posix_fadvise(file_descriptor.fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+            FSContentHash hasher;
+            std::size_t read_offset(0);
+            for (;;)
+            {
+                const ssize_t read_bytes(__preadFully(file_descriptor.fd, _buffer, FS_STREAM_CHUNK_SIZE, read_offset));
+                if (read_bytes < 0)
+                    return false;
+                if (read_bytes == 0)
+                    break;
+                hasher.Update(_buffer, static_cast<std::size_t>(read_bytes));
+                read_offset += static_cast<std::size_t>(read_bytes);
+            }
+            _hash = hasher.Digest();
+            return true;
         };
 
         /**
          *
-         * Verify the state of a memory map.
+         * Positional read of up to _length bytes at _offset, retries on interruption and short reads.
          *
-         * @param fMap_t& map_ptr The pointer to the mapped memory region.
+         * @param int the file descriptor
+         * @param char* destination buffer
+         * @param std::size_t bytes to read
+         * @param std::size_t file offset
          *
-         * @throws std::runtime_error If the memory map is invalid.
+         * @returns ssize_t bytes read(less than _length only at end of file), -1 on error
          */
-        __0x_attr_FSC_vms inline void __verifyMemMapState(const fMap_t &map_ptr)
+        static inline ssize_t __preadFully(const int _fd, char *_buffer, const std::size_t _length, const std::size_t _offset) noexcept
         {
-            if (map_ptr == MAP_FAILED) [[unlikely]]
-                throw std::runtime_error(String_t("Error mapping file: ") + strerror(errno));
+            std::size_t read_total(0);
+            while (read_total < _length)
+            {
+                const ssize_t read_bytes(pread(_fd, _buffer + read_total, _length - read_total, static_cast<off_t>(_offset + read_total)));
+                if (read_bytes < 0 && errno == EINTR)
+                    continue;
+                if (read_bytes < 0)
+                    return -1;
+                if (read_bytes == 0)
+                    break;
+                read_total += static_cast<std::size_t>(read_bytes);
+            }
+            FS_INSTRUMENT_COUNT(eIoCounter::BYTES_READ, read_total);
+            return static_cast<ssize_t>(read_total);
         };
 
         /**
@@ -1361,7 +7478,8 @@ namespace FSControllerModule
 
         /**
          *
-         * Recursive directory aggregation, aggregate entries into recursive_scan.
+         * Recursive directory aggregation, aggregate entries into recursive_scan, the files of every
+         * directory are read in FSReadPlanner order, the next ones hinted meanwhile.
          * @param StringView_t the path for directory
          * @param directoryScanResult_t the aggregation block for new entries to use
          * @returns void
@@ -1371,6 +7489,7 @@ namespace FSControllerModule
             const StringView_t &_p, directoryScanResult_t &recursive_scan) noexcept {
             if (IsDirectory(_p))
             {
+                std::vector<String_t> directory_files;
                 std::filesystem::directory_iterator rdi(_p);
                 for (auto &dir_entry : rdi)
                 {
@@ -1380,26 +7499,376 @@ namespace FSControllerModule
                     }
                     else
                     {
-                        struct stFileDescriptor new_description = this->FileRead(dir_entry.path().string(), false);
-                        if (new_description.file_size > 0)
-                        {
-                            recursive_scan.insert_or_assign(static_cast<_ForeignKeyType_>(new_description.file_name), std::move(new_description));
-                        }
+                        directory_files.push_back(dir_entry.path().string());
+                    }
+                }
+                FSReadPlanner read_plan(directory_files);
+                for (std::size_t position = 0; position < read_plan.Size(); ++position)
+                {
+                    read_plan.Advance(position);
+                    struct stFileDescriptor new_description = this->FileRead(read_plan[position], false);
+                    if (new_description.file_size > 0)
+                    {
+                        recursive_scan.insert_or_assign(static_cast<_ForeignKeyType_>(new_description.file_name), std::move(new_description));
+                    }
+                }
+            }
+        };
+
+        /**
+         *
+         * Run _work as one operation of the shared FSAsyncExecutor, its result or exception is
+         * delivered through the returned future, or to _on_complete when one is given.
+         * @param _Work callable(stOperationControl&) -> _Result
+         * @param stAsyncOptions cancellation token and progress callback, owned by the operation
+         * @param asyncCallback_t<_Result> optional! completion callback, receives the ready future
+         * @param bool optional! if false, park past FS_ASYNC_MAX_PENDING instead of blocking
+         * @returns std::future<_Result> the operation future, invalid when _on_complete is set
+         *
+         */
+        template <typename _Result, typename _Work>
+        static std::future<_Result> __submitAsync(_Work &&_work, stAsyncOptions _options, asyncCallback_t<_Result> _on_complete = nullptr, const bool _wait_for_capacity = true)
+        {
+            std::shared_ptr<std::promise<_Result>> operation_promise(std::make_shared<std::promise<_Result>>());
+            std::future<_Result> operation_future(operation_promise->get_future());
+            std::shared_ptr<std::future<_Result>> callback_future; /* Task_t must stay copyable */
+            if (_on_complete)
+                callback_future = std::make_shared<std::future<_Result>>(std::move(operation_future));
+            FSAsyncExecutor::Shared().Post([operation_promise, work = std::forward<_Work>(_work), options = std::move(_options), on_complete = std::move(_on_complete), callback_future]() mutable
+                                           {
+                stOperationControl operation_control(options);
+                try
+                {
+                    operation_control.ThrowIfCancelled();
+                    if constexpr (std::is_void_v<_Result>)
+                    {
+                        work(operation_control);
+                        operation_promise->set_value();
+                    }
+                    else
+                        operation_promise->set_value(work(operation_control));
+                }
+                catch (...)
+                {
+                    operation_promise->set_exception(std::current_exception());
+                }
+                if (on_complete)
+                    on_complete(std::move(*callback_future)); }, _wait_for_capacity);
+            return operation_future;
+        };
+
+#if defined(FS_HAS_COROUTINES)
+        /* awaitable posting _work to the shared FSAsyncExecutor once co_await'ed, past the pending bound the operation is parked instead of blocking await_suspend */
+        template <typename _Result, typename _Work>
+        static FSOperationAwaitable<_Result> __awaitAsync(_Work &&_work, stAsyncOptions _options)
+        {
+            return FSOperationAwaitable<_Result>([work = std::forward<_Work>(_work), options = std::move(_options)](asyncCallback_t<_Result> _on_complete)
+                                                 { __submitAsync<_Result>(work, options, std::move(_on_complete), false); });
+        };
+#endif
+
+        /* FileReadAsync operation body, chunked read with a cancellation check per chunk */
+        inline auto __fileReadAsyncWork(String_t _file_name)
+        {
+            return [this, _file_name = std::move(_file_name)](stOperationControl &_control)
+            {
+                String_t file_content;
+                struct stat file_stat;
+                if (stat(_file_name.c_str(), &file_stat) == 0 && S_ISREG(file_stat.st_mode))
+                {
+                    file_content.reserve(static_cast<std::size_t>(file_stat.st_size));
+                    _control.AddTotal(static_cast<std::size_t>(file_stat.st_size));
+                }
+                const std::size_t read_bytes(this->FileReadChunked(_file_name, [&](const StringView_t _chunk, const std::size_t)
+                                                                   {
+                    file_content.append(_chunk);
+                    _control.Advance(_chunk.size());
+                    return !_control.Cancelled(); }, stChunkReadOptions{.read_ahead = false}));
+                _control.ThrowIfCancelled();
+                file_content.resize(read_bytes);
+                return file_content;
+            };
+        };
+
+        /* FileWriteAsync operation body */
+        inline auto __fileWriteAsyncWork(String_t _file_name, String_t _buffer, const bool _create_new)
+        {
+            return [this, _file_name = std::move(_file_name), _buffer = std::move(_buffer), _create_new](stOperationControl &_control)
+            {
+                _control.AddTotal(_buffer.size());
+                this->FileWrite(_file_name, _buffer, _create_new);
+                _control.Advance(_buffer.size());
+            };
+        };
+
+        /* DirectoryProfilerAsync operation body, the walk runs on the executor pool */
+        inline auto __directoryProfilerAsyncWork(String_t _path)
+        {
+            return [this, _path = std::move(_path)](stOperationControl &_control)
+            { return this->__directoryProfilerParallel(_path, FSAsyncExecutor::Shared().Pool(), &_control); };
+        };
+
+        /* CreateDirectoryBackupAsync operation body, copies run on the executor pool */
+        inline auto __directoryBackupAsyncWork(String_t dir_source, String_t dir_dest, const stBackupOptions &_backup_options)
+        {
+            return [this, dir_source = std::move(dir_source), dir_dest = std::move(dir_dest), _backup_options](stOperationControl &_control)
+            { return this->__directoryBackupIncremental(dir_source, dir_dest, _backup_options, FSAsyncExecutor::Shared().Pool(), &_control); };
+        };
+
+        /* GetDirectorySizeAsync operation body */
+        static auto __directorySizeAsyncWork(String_t _directory, const stDirectorySizeOptions &_size_options)
+        {
+            return [_directory = std::move(_directory), _size_options](stOperationControl &_control) -> std::size_t
+            {
+                if (_directory.empty() || !IsDirectory(_directory))
+                    return 0;
+                return __directorySizeParallel(_directory, _size_options, FSAsyncExecutor::Shared().Pool(), &_control);
+            };
+        };
+
+        /**
+         *
+         * DirectoryProfiler on _pool, shared by the parallel and async variants.
+         * @param StringView_t& absolute directory path
+         * @param FSWorkStealingPool& pool running the walk and the reads
+         * @param stOperationControl* optional cancellation/progress, progress counts files
+         * @returns directoryScanResult_t the aggregation
+         *
+         * @throws FSOperationCancelled If _control was cancelled.
+         */
+        inline const directoryScanResult_t __directoryProfilerParallel(const StringView_t &path, FSWorkStealingPool &_pool, stOperationControl *_control)
+        {
+            FS_INSTRUMENT_SCOPE(eInstrumentedOp::DIRECTORY_PROFILER);
+            directoryScanResult_t scan_result;
+
+            if (path.empty() || path.length() >= FS_MAX_FILE_NAME_LENGTH)
+                return scan_result;
+            if (!std::filesystem::path(path).is_absolute())
+                throw std::runtime_error("Use an absolute path please!");
+            if (!IsDirectory(path))
+                return scan_result;
+
+            std::vector<directoryScanResult_t> partial_results(_pool.WorkerCount() + 1); /* one slot per worker, last slot for foreign threads */
+            {
+                FSTaskGroup task_group(_pool);
+                this->__parallelAggregation(static_cast<String_t>(path), _pool, task_group, partial_results, _control);
+                task_group.Wait();
+            }
+            if (_control != nullptr)
+                _control->ThrowIfCancelled();
+
+            std::size_t largest_partial(0);
+            for (std::size_t p = 1; p < partial_results.size(); ++p)
+                if (partial_results[p].size() > partial_results[largest_partial].size())
+                    largest_partial = p;
+
+            scan_result = std::move(partial_results[largest_partial]);
+            for (directoryScanResult_t &partial : partial_results)
+                scan_result.merge(partial);
+            return scan_result;
+        };
+
+        /**
+         *
+         * Parallel directory aggregation, queue expansion of _p on _group, subdirectories become new
+         * tasks. regular files of the directory are planned together once it was listed, the plan is
+         * then read in batches of FS_PARALLEL_READ_BATCH planned positions.
+         * @param String_t the path for directory
+         * @param FSWorkStealingPool& the pool running the walk
+         * @param FSTaskGroup& the group tracking walk completion
+         * @param std::vector<directoryScanResult_t>& per-worker partial results
+         * @param stOperationControl* optional! cancellation/progress, the walk stops once cancelled
+         * @returns void
+         *
+         */
+        inline void __parallelAggregation(String_t _p, FSWorkStealingPool &_pool, FSTaskGroup &_group, std::vector<directoryScanResult_t> &_partials, stOperationControl *_control = nullptr)
+        {
+            _group.Run([this, _p = std::move(_p), &_pool, &_group, &_partials, _control]
+                       {
+                std::shared_ptr<stDirectoryReadPlan> directory_plan(std::make_shared<stDirectoryReadPlan>());
+                FSDirectoryWalker::Walk(_p, stWalkOptions{.recursive = false, .skip_errors = true}, [&](const stWalkEntry &dir_entry)
+                                        {
+                    if (_control != nullptr && _control->Cancelled())
+                        return eWalkAction::STOP;
+                    if (dir_entry.type == eDirEntryType::DIRECTORY)
+                    {
+                        this->__parallelAggregation(static_cast<String_t>(dir_entry.path), _pool, _group, _partials, _control);
+                    }
+                    else if (dir_entry.ResolvedType() == eDirEntryType::REGULAR)
+                    {
+                        if (_control != nullptr)
+                            _control->AddTotal(1);
+                        if (directory_plan->directory_descriptor.fd == -1)
+                            directory_plan->directory_descriptor.fd = fcntl(dir_entry.parent_fd, F_DUPFD_CLOEXEC, 0); /* outlives the walk, -1 falls back to full paths */
+                        directory_plan->paths.emplace_back(dir_entry.path);
+                        directory_plan->inodes.push_back(dir_entry.inode);
+                    }
+                    return eWalkAction::CONTINUE; });
+                if (directory_plan->paths.empty())
+                    return;
+                directory_plan->read_plan.emplace(directory_plan->paths, static_cast<eReadOrder>(FS_READ_PLAN_ORDER), FS_READ_PLAN_LOOKAHEAD, &directory_plan->inodes, directory_plan->directory_descriptor.fd);
+                const std::size_t planned_total(directory_plan->paths.size());
+                for (std::size_t batch_begin = FS_PARALLEL_READ_BATCH; batch_begin < planned_total; batch_begin += FS_PARALLEL_READ_BATCH)
+                {
+                    const std::size_t batch_end(std::min(planned_total, batch_begin + FS_PARALLEL_READ_BATCH));
+                    _group.Run([this, directory_plan, batch_begin, batch_end, &_pool, &_partials, _control]
+                               { this->__aggregateFileBatch(*directory_plan->read_plan, batch_begin, batch_end, _pool, _partials, _control); });
+                }
+                this->__aggregateFileBatch(*directory_plan->read_plan, 0, std::min(planned_total, FS_PARALLEL_READ_BATCH), _pool, _partials, _control); });
+        };
+
+        /**
+         *
+         * Read planned positions [_range_begin, _range_end) of _read_plan into the partial result owned
+         * by the calling worker, the next planned files are hinted while the current one is read,
+         * unreadable files are skipped.
+         * @param FSReadPlanner& plan of the directory being read
+         * @param std::size_t first planned position to read
+         * @param std::size_t end of the planned positions to read
+         * @param FSWorkStealingPool& the pool running the walk
+         * @param std::vector<directoryScanResult_t>& per-worker partial results
+         * @param stOperationControl* optional! cancellation/progress, one unit per file
+         * @returns void
+         *
+         */
+        inline void __aggregateFileBatch(const FSReadPlanner &_read_plan, const std::size_t _range_begin, const std::size_t _range_end, FSWorkStealingPool &_pool, std::vector<directoryScanResult_t> &_partials, stOperationControl *_control = nullptr)
+        {
+            const std::size_t worker_index(_pool.CurrentWorkerIndex());
+            directoryScanResult_t &partial(_partials[worker_index != FSWorkStealingPool::npos ? worker_index : _partials.size() - 1]);
+            for (std::size_t position = _range_begin; position < _range_end; ++position)
+            {
+                if (_control != nullptr && _control->Cancelled())
+                    return;
+                _read_plan.Advance(position, _range_begin, _range_end);
+                struct stFileDescriptor new_description;
+                if (this->__profileFile(_read_plan[position], new_description))
+                    partial.insert_or_assign(static_cast<_ForeignKeyType_>(new_description.file_name), std::move(new_description));
+                if (_control != nullptr)
+                    _control->Advance(1);
+            }
+        };
+
+        /**
+         *
+         * Scan _content for _state.needle, first byte candidates come from memchr, the last byte and
+         * then the remaining bytes are compared before a match is reported. line numbers are
+         * maintained incrementally by counting newlines between consecutive matches.
+         * @param StringView_t& path reported with the matches
+         * @param StringView_t& the content to scan
+         * @param stContentSearchState& shared search state
+         * @returns void
+         *
+         */
+        __0x_attr_FSC_scntb static void __searchContent(const StringView_t &_path, const StringView_t &_content, stContentSearchState &_state)
+        {
+            const std::size_t needle_size(_state.needle.size());
+            if (_content.size() < needle_size)
+                return;
+            const char *content_begin(_content.data()), *content_end(content_begin + _content.size());
+            const char *candidate_end(content_end - needle_size + 1);
+            const char needle_first(_state.needle.front()), needle_last(_state.needle.back());
+            const char *counted_until(content_begin), *line_begin(content_begin);
+            std::size_t line_number(1), file_matches(0);
+
+            for (const char *candidate = content_begin; candidate < candidate_end;)
+            {
+                candidate = static_cast<const char *>(std::memchr(candidate, needle_first, static_cast<std::size_t>(candidate_end - candidate)));
+                if (candidate == nullptr)
+                    break;
+                if (candidate[needle_size - 1] != needle_last || std::memcmp(candidate, _state.needle.data(), needle_size) != 0)
+                {
+                    ++candidate;
+                    continue;
+                }
+
+                for (const char *newline; (newline = static_cast<const char *>(std::memchr(counted_until, '\n', static_cast<std::size_t>(candidate - counted_until)))) != nullptr; counted_until = newline + 1)
+                {
+                    ++line_number;
+                    line_begin = newline + 1;
+                }
+                counted_until = candidate;
+                const char *line_end(static_cast<const char *>(std::memchr(candidate, '\n', static_cast<std::size_t>(content_end - candidate))));
+                if (line_end == nullptr)
+                    line_end = content_end;
+
+                {
+                    std::lock_guard<std::mutex> _lock(_state.callback_guard);
+                    if (_state.stop.load(std::memory_order_relaxed))
+                        return;
+                    _state.match_count.fetch_add(1, std::memory_order_relaxed);
+                    if (!_state.on_match(stContentMatch{.path = _path, .offset = static_cast<std::size_t>(candidate - content_begin), .line_number = line_number, .line = StringView_t(line_begin, static_cast<std::size_t>(line_end - line_begin))}))
+                    {
+                        _state.stop.store(true, std::memory_order_relaxed);
+                        return;
                     }
                 }
+                if (_state.max_matches_per_file > 0 && ++file_matches >= _state.max_matches_per_file)
+                    return;
+                candidate += needle_size;
+            }
+        };
+
+        /* modification time of _stat */
+        static inline const struct timespec __statMtime(const struct stat &_stat) noexcept
+        {
+#if defined(__APPLE__)
+            return _stat.st_mtimespec;
+#else
+            return _stat.st_mtim;
+#endif
+        };
+
+        /**
+         *
+         * Read _file_path into _description the way the directory profilers do, empty and unreadable
+         * files are not profiled.
+         * @param String_t& the file to read
+         * @param stFileDescriptor& receives the profile
+         * @returns bool true if _description was filled
+         *
+         */
+        inline const bool __profileFile(const String_t &_file_path, struct stFileDescriptor &_description)
+        {
+            try
+            {
+                _description = this->__createEmptyProfilerStructure(_file_path);
+                stMappedFileView file_view(this->__mapFileView(_file_path, eMapAdvice::SEQUENTIAL));
+                if (file_view.Empty())
+                    return false;
+                _description.file_size = file_view.Size();
+                _description.file_content.assign(file_view.Data(), file_view.Size());
+                FS_INSTRUMENT_COUNT(eIoCounter::BYTES_READ, file_view.Size());
+                return true;
+            }
+            catch (const std::runtime_error &)
+            {
+                return false;
             }
         };
 
         /**
          * 
-         * Verify if directories(source, backup) are the same by checking they're size...
+         * Verify if directories(source, backup) are the same file by file with the given mode(see
+         * DirectoryBackupVerify), empty source files missing from the backup are accepted unless
+         * they were meant to be copied...
          * @param StringView_t& source
          * @param StringView_t& destination
+         * @param eBackupVerifyMode per file verification tier
+         * @param bool true if empty files were copied, missing empty files then fail verification
          * @returns bool true if same
          * 
          */
-        __0x_attr_FSC_dirbkv const bool __directoryBackupVerify(const StringView_t& source, const StringView_t& destination) {
-            return this->GetDirectorySize(source) == this->GetDirectorySize(destination);
+        __0x_attr_FSC_dirbkv const bool __directoryBackupVerify(const StringView_t& source, const StringView_t& destination, const eBackupVerifyMode _mode, const bool _copy_empty_files) {
+            const stBackupVerifyReport verify_report(this->DirectoryBackupVerify(source, destination, _mode));
+            if (!verify_report.mismatched.empty() || !verify_report.extra.empty())
+                return false;
+            for (const String_t &missing_path : verify_report.missing)
+            {
+                struct stat missing_stat;
+                if (_copy_empty_files || stat((std::filesystem::path(source) / missing_path).c_str(), &missing_stat) == -1 || missing_stat.st_size > 0)
+                    return false;
+            }
+            return true;
         };
     };
 
@@ -0,0 +1,445 @@
+/**
+ *
+ * FSController benchmark suite
+ *
+ * generates a deterministic synthetic tree and measures FSController hot paths, every operation
+ * reports throughput, per call latency percentiles, read/write syscall counts(/proc/self/io) and
+ * peak RSS(VmHWM, reset through /proc/self/clear_refs before each operation). results are
+ * written as JSON so runs can be diffed between releases.
+ *
+ * rw_syscalls are the kernel syscr/syscw counters: read(2)/write(2) family calls only(read,
+ * pread, readv, write, pwrite, writev, sendfile...). open, stat, getdents, mmap, fsync, rename,
+ * copy_file_range, io_uring submissions and page faults of mapped reads are not counted, so
+ * operations built on those report fewer syscalls than they make, count them with strace -c.
+ *
+ * the tree lives in <root>/fsc_bench.<pid>, the only directory the bench creates and removes,
+ * --root itself is never deleted.
+ *
+ * build: g++ -std=c++20 -O2 -pthread -I.. FSControllerBench.cpp -o fsc_bench
+ * run:   ./fsc_bench --root /tmp --depth 3 --fanout 4 --files 32 --dist mixed --json bench.json
+ *
+ */
+
+#include "../FSController.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <sys/resource.h>
+
+using namespace FSControllerModule;
+
+/*                   Configuration                       *\
+\*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+enum class eSizeDistribution : uint8_t
+{
+    TINY = 0, /* 1B - 512B */
+    PAGE,     /* 4KiB +- 512B */
+    HUGE,     /* 8MiB - 32MiB */
+    MIXED     /* 80% tiny, 19% page, 1% huge */
+};
+
+typedef struct alignas(void *)
+{
+    String_t root{"/tmp"};         /* parent of the bench directory, left in place */
+    String_t bench_dir{};          /* <root>/fsc_bench.<pid>, created and removed by the bench */
+    String_t json_path{};          /* empty writes JSON to stdout */
+    std::size_t depth{3};          /* directory levels below the root */
+    std::size_t fanout{4};         /* subdirectories per directory */
+    std::size_t files_per_dir{32}; /* files per directory */
+    std::size_t iterations{3};     /* repetitions of every operation */
+    std::size_t workers{0};        /* parallel operations workers, 0 uses hardware concurrency */
+    std::uint64_t seed{0x5EEDull};
+    eSizeDistribution distribution{eSizeDistribution::MIXED};
+    bool keep_tree{false};
+} stBenchConfig;
+
+/*                  Measurement                          *\
+\*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+typedef struct alignas(void *)
+{
+    std::uint64_t syscalls_read{0};
+    std::uint64_t syscalls_write{0};
+    std::uint64_t bytes_read{0};    /* rchar */
+    std::uint64_t bytes_written{0}; /* wchar */
+} stIoCounters;
+
+typedef struct alignas(void *)
+{
+    String_t name{};
+    std::size_t calls{0};
+    std::uint64_t bytes{0};
+    double seconds{0};
+    std::vector<std::uint64_t> latencies_ns{};
+    stIoCounters io{};
+    std::uint64_t peak_rss_kb{0};
+} stBenchResult;
+
+static const stIoCounters ReadIoCounters(void)
+{
+    stIoCounters io_counters;
+    std::ifstream proc_io("/proc/self/io");
+    String_t counter_name;
+    std::uint64_t counter_value;
+    while (proc_io >> counter_name >> counter_value)
+    {
+        if (counter_name == "syscr:")
+            io_counters.syscalls_read = counter_value;
+        else if (counter_name == "syscw:")
+            io_counters.syscalls_write = counter_value;
+        else if (counter_name == "rchar:")
+            io_counters.bytes_read = counter_value;
+        else if (counter_name == "wchar:")
+            io_counters.bytes_written = counter_value;
+    }
+    return io_counters;
+}
+
+/* reset the peak RSS watermark, falls back to the process lifetime peak when not permitted */
+static void ResetPeakRss(void)
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs)
+        clear_refs << "5";
+}
+
+static const std::uint64_t ReadPeakRssKb(void)
+{
+    std::ifstream proc_status("/proc/self/status");
+    String_t status_line;
+    while (std::getline(proc_status, status_line))
+        if (status_line.starts_with("VmHWM:"))
+            return std::strtoull(status_line.c_str() + 6, nullptr, 10);
+    struct rusage process_usage;
+    getrusage(RUSAGE_SELF, &process_usage);
+    return static_cast<std::uint64_t>(process_usage.ru_maxrss);
+}
+
+/**
+ *
+ * run _operation _iterations times, _operation performs a batch of calls through the _call
+ * wrapper it receives, so per call latencies are recorded while the batch is measured as a whole.
+ * _operation returns the number of payload bytes it moved.
+ */
+template <typename _Operation>
+static stBenchResult Measure(const String_t &_name, const std::size_t _iterations, _Operation &&_operation)
+{
+    stBenchResult bench_result{.name{_name}};
+    ResetPeakRss();
+    const stIoCounters io_before(ReadIoCounters());
+    const auto wall_begin(std::chrono::steady_clock::now());
+    for (std::size_t iteration = 0; iteration < _iterations; ++iteration)
+    {
+        auto timed_call = [&bench_result](auto &&_call)
+        {
+            const auto call_begin(std::chrono::steady_clock::now());
+            _call();
+            bench_result.latencies_ns.push_back(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - call_begin).count()));
+            ++bench_result.calls;
+        };
+        bench_result.bytes += _operation(timed_call);
+    }
+    bench_result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_begin).count();
+    const stIoCounters io_after(ReadIoCounters());
+    bench_result.io = stIoCounters{.syscalls_read = io_after.syscalls_read - io_before.syscalls_read,
+                                   .syscalls_write = io_after.syscalls_write - io_before.syscalls_write,
+                                   .bytes_read = io_after.bytes_read - io_before.bytes_read,
+                                   .bytes_written = io_after.bytes_written - io_before.bytes_written};
+    bench_result.peak_rss_kb = ReadPeakRssKb();
+    return bench_result;
+}
+
+static const std::uint64_t Percentile(std::vector<std::uint64_t> &_sorted, const double _rank)
+{
+    if (_sorted.empty())
+        return 0;
+    return _sorted[std::min(_sorted.size() - 1, static_cast<std::size_t>(_rank * static_cast<double>(_sorted.size() - 1) + 0.5))];
+}
+
+/*                 Synthetic Tree                        *\
+\*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+typedef struct alignas(void *)
+{
+    std::vector<String_t> directories{};
+    std::vector<String_t> files{};
+    std::uint64_t total_bytes{0};
+} stSyntheticTree;
+
+static const std::size_t DrawFileSize(std::mt19937_64 &_rng, const eSizeDistribution _distribution)
+{
+    eSizeDistribution size_class(_distribution);
+    if (size_class == eSizeDistribution::MIXED)
+    {
+        const std::uint64_t class_draw(_rng() % 100);
+        size_class = class_draw < 80 ? eSizeDistribution::TINY : class_draw < 99 ? eSizeDistribution::PAGE : eSizeDistribution::HUGE;
+    }
+    switch (size_class)
+    {
+    case eSizeDistribution::TINY:
+        return 1 + _rng() % 512;
+    case eSizeDistribution::PAGE:
+        return 3584 + _rng() % 1024;
+    default:
+        return (8u << 20) + _rng() % (24u << 20);
+    }
+}
+
+/* same config and seed always produce the same paths, sizes and bytes */
+static const stSyntheticTree GenerateTree(const stBenchConfig &_config)
+{
+    stSyntheticTree synthetic_tree;
+    std::mt19937_64 rng(_config.seed);
+    std::vector<std::pair<String_t, std::size_t>> pending_dirs{{_config.bench_dir + "/source", 0}};
+    String_t content_buffer;
+
+    while (!pending_dirs.empty())
+    {
+        const auto [dir_path, dir_depth] = pending_dirs.back();
+        pending_dirs.pop_back();
+        std::filesystem::create_directories(dir_path);
+        synthetic_tree.directories.push_back(dir_path);
+
+        for (std::size_t f = 0; f < _config.files_per_dir; ++f)
+        {
+            const std::size_t file_size(DrawFileSize(rng, _config.distribution));
+            content_buffer.resize(file_size);
+            for (std::size_t i = 0; i < file_size; i += sizeof(std::uint64_t))
+            {
+                const std::uint64_t random_word(rng());
+                std::memcpy(content_buffer.data() + i, &random_word, std::min(sizeof(random_word), file_size - i));
+            }
+            const String_t file_path(dir_path + "/file_" + std::to_string(f) + ".dat");
+            std::ofstream(file_path, std::ios::binary | std::ios::trunc).write(content_buffer.data(), static_cast<std::streamsize>(file_size));
+            synthetic_tree.files.push_back(file_path);
+            synthetic_tree.total_bytes += file_size;
+        }
+        if (dir_depth < _config.depth)
+            for (std::size_t d = 0; d < _config.fanout; ++d)
+                pending_dirs.emplace_back(dir_path + "/dir_" + std::to_string(d), dir_depth + 1);
+    }
+    return synthetic_tree;
+}
+
+/*                      Output                           *\
+\*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+static const char *DistributionName(const eSizeDistribution _distribution)
+{
+    switch (_distribution)
+    {
+    case eSizeDistribution::TINY:
+        return "tiny";
+    case eSizeDistribution::PAGE:
+        return "page";
+    case eSizeDistribution::HUGE:
+        return "huge";
+    default:
+        return "mixed";
+    }
+}
+
+static void WriteJson(std::ostream &_out, const stBenchConfig &_config, const stSyntheticTree &_tree, std::vector<stBenchResult> &_results)
+{
+    _out << "{\n  \"config\": {\"depth\": " << _config.depth << ", \"fanout\": " << _config.fanout << ", \"files_per_dir\": " << _config.files_per_dir
+         << ", \"distribution\": \"" << DistributionName(_config.distribution) << "\", \"seed\": " << _config.seed << ", \"iterations\": " << _config.iterations
+         << ", \"workers\": " << _config.workers << ", \"directories\": " << _tree.directories.size() << ", \"files\": " << _tree.files.size()
+         << ", \"tree_bytes\": " << _tree.total_bytes << "},\n  \"results\": [\n";
+    for (std::size_t r = 0; r < _results.size(); ++r)
+    {
+        stBenchResult &bench_result(_results[r]);
+        std::sort(bench_result.latencies_ns.begin(), bench_result.latencies_ns.end());
+        const double seconds(bench_result.seconds > 0 ? bench_result.seconds : 1e-9);
+        char number_buffer[64];
+        _out << "    {\"name\": \"" << bench_result.name << "\", \"calls\": " << bench_result.calls << ", \"bytes\": " << bench_result.bytes;
+        std::snprintf(number_buffer, sizeof(number_buffer), "%.6f", bench_result.seconds);
+        _out << ", \"seconds\": " << number_buffer;
+        std::snprintf(number_buffer, sizeof(number_buffer), "%.2f", static_cast<double>(bench_result.calls) / seconds);
+        _out << ", \"calls_per_sec\": " << number_buffer;
+        std::snprintf(number_buffer, sizeof(number_buffer), "%.2f", static_cast<double>(bench_result.bytes) / seconds / (1024.0 * 1024.0));
+        _out << ", \"mib_per_sec\": " << number_buffer;
+        _out << ", \"latency_ns\": {\"p50\": " << Percentile(bench_result.latencies_ns, 0.50) << ", \"p90\": " << Percentile(bench_result.latencies_ns, 0.90)
+             << ", \"p99\": " << Percentile(bench_result.latencies_ns, 0.99) << ", \"max\": " << (bench_result.latencies_ns.empty() ? 0 : bench_result.latencies_ns.back()) << "}";
+        _out << ", \"rw_syscalls\": {\"read\": " << bench_result.io.syscalls_read << ", \"write\": " << bench_result.io.syscalls_write << "}";
+        _out << ", \"io_bytes\": {\"read\": " << bench_result.io.bytes_read << ", \"written\": " << bench_result.io.bytes_written << "}";
+        _out << ", \"peak_rss_kb\": " << bench_result.peak_rss_kb << "}" << (r + 1 < _results.size() ? ",\n" : "\n");
+    }
+    _out << "  ]\n}\n";
+}
+
+static const bool ParseArguments(const int argc, char **argv, stBenchConfig &_config)
+{
+    for (int a = 1; a < argc; ++a)
+    {
+        const StringView_t argument(argv[a]);
+        const char *value(a + 1 < argc ? argv[a + 1] : nullptr);
+        if (argument == "--keep")
+        {
+            _config.keep_tree = true;
+            continue;
+        }
+        if (value == nullptr)
+            return false;
+        ++a;
+        if (argument == "--root")
+            _config.root = value;
+        else if (argument == "--json")
+            _config.json_path = value;
+        else if (argument == "--depth")
+            _config.depth = std::strtoull(value, nullptr, 10);
+        else if (argument == "--fanout")
+            _config.fanout = std::strtoull(value, nullptr, 10);
+        else if (argument == "--files")
+            _config.files_per_dir = std::strtoull(value, nullptr, 10);
+        else if (argument == "--iterations")
+            _config.iterations = std::max<std::size_t>(1, std::strtoull(value, nullptr, 10));
+        else if (argument == "--workers")
+            _config.workers = std::strtoull(value, nullptr, 10);
+        else if (argument == "--seed")
+            _config.seed = std::strtoull(value, nullptr, 0);
+        else if (argument == "--dist")
+        {
+            const StringView_t dist(value);
+            _config.distribution = dist == "tiny" ? eSizeDistribution::TINY : dist == "page" ? eSizeDistribution::PAGE
+                                                                           : dist == "huge"   ? eSizeDistribution::HUGE
+                                                                                              : eSizeDistribution::MIXED;
+        }
+        else
+            return false;
+    }
+    return true;
+}
+
+/*                    Benchmarks                         *\
+\*+++++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+int main(int argc, char **argv)
+{
+    stBenchConfig bench_config;
+    if (!ParseArguments(argc, argv, bench_config))
+    {
+        std::cerr << "usage: " << argv[0] << " [--root dir] [--depth n] [--fanout n] [--files n] [--dist tiny|page|huge|mixed] [--seed n] [--iterations n] [--workers n] [--json file] [--keep]\n";
+        return 2;
+    }
+
+    bench_config.bench_dir = bench_config.root + "/fsc_bench." + std::to_string(getpid());
+    std::error_code create_error;
+    std::filesystem::create_directories(bench_config.root, create_error);
+    if (!std::filesystem::create_directory(bench_config.bench_dir, create_error))
+    {
+        std::cerr << "cannot create bench directory " << bench_config.bench_dir << ": " << (create_error ? create_error.message() : "already exists") << "\n";
+        return 1;
+    }
+    const stSyntheticTree synthetic_tree(GenerateTree(bench_config));
+    const String_t source_root(bench_config.bench_dir + "/source");
+    const String_t scratch_root(bench_config.bench_dir + "/scratch");
+    std::filesystem::create_directories(scratch_root);
+
+    FSController<String_t> fsc;
+    std::vector<stBenchResult> bench_results;
+
+    bench_results.push_back(Measure("FileRead", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t read_bytes(0);
+        for (const String_t &file_path : synthetic_tree.files)
+            _timed_call([&] { read_bytes += fsc.FileRead(file_path).file_size; });
+        return read_bytes; }));
+
+    bench_results.push_back(Measure("FileReadView", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t read_bytes(0);
+        for (const String_t &file_path : synthetic_tree.files)
+            _timed_call([&] { read_bytes += fsc.FileReadView(file_path, eMapAdvice::SEQUENTIAL).Size(); });
+        return read_bytes; }));
+
+    bench_results.push_back(Measure("FileReadMany", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t read_bytes(0);
+        _timed_call([&] { for (const stFileDescriptor &read_profile : fsc.FileReadMany(synthetic_tree.files)) read_bytes += read_profile.file_size; });
+        return read_bytes; }));
+
+    const String_t write_payload(4096, 'w');
+    bench_results.push_back(Measure("FileWrite", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t written_bytes(0);
+        for (std::size_t f = 0; f < synthetic_tree.files.size(); ++f)
+        {
+            const String_t scratch_file(scratch_root + "/write_" + std::to_string(f));
+            _timed_call([&] { fsc.FileWrite(scratch_file, write_payload, true); });
+            written_bytes += write_payload.size();
+        }
+        return written_bytes; }));
+
+    bench_results.push_back(Measure("FileWriteAtomic", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t written_bytes(0);
+        for (std::size_t f = 0; f < std::min<std::size_t>(synthetic_tree.files.size(), 64); ++f)
+        {
+            const String_t scratch_file(scratch_root + "/atomic_" + std::to_string(f));
+            _timed_call([&] { fsc.FileWriteAtomic(scratch_file, write_payload); });
+            written_bytes += write_payload.size();
+        }
+        return written_bytes; }));
+
+    bench_results.push_back(Measure("DirectoryProfiler", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t profiled_bytes(0);
+        _timed_call([&] { for (const auto &[fk, profile] : fsc.DirectoryProfiler(source_root)) profiled_bytes += profile.file_size; });
+        return profiled_bytes; }));
+
+    bench_results.push_back(Measure("DirectoryProfilerParallel", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t profiled_bytes(0);
+        _timed_call([&] { for (const auto &[fk, profile] : fsc.DirectoryProfiler(source_root, bench_config.workers)) profiled_bytes += profile.file_size; });
+        return profiled_bytes; }));
+
+    bench_results.push_back(Measure("GetDirectorySize", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t measured_bytes(0);
+        _timed_call([&] { measured_bytes += fsc.GetDirectorySize(source_root); });
+        return measured_bytes; }));
+
+    bench_results.push_back(Measure("GetDirectorySizeDetachHandler", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::uint64_t measured_bytes(0);
+        _timed_call([&] { measured_bytes += fsc.GetDirectorySizeDetachHandler(source_root, {.worker_count = bench_config.workers}); });
+        return measured_bytes; }));
+
+    bench_results.push_back(Measure("CreateDirectoryBackup", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        const String_t backup_root(scratch_root + "/backup");
+        std::filesystem::remove_all(backup_root);
+        bool backup_created(false);
+        _timed_call([&] { backup_created = fsc.CreateDirectoryBackup(source_root, backup_root, true, true, true); });
+        return backup_created ? synthetic_tree.total_bytes : std::uint64_t(0); }));
+
+    bench_results.push_back(Measure("CreateDirectoryBackupIncremental", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        const String_t backup_root(scratch_root + "/backup_incremental");
+        std::uint64_t copied_bytes(0);
+        _timed_call([&] { copied_bytes += fsc.CreateDirectoryBackupIncremental(source_root, backup_root, {.create_backup_dir = true, .copy_empty_files = true, .worker_count = bench_config.workers}).bytes_copied; });
+        return copied_bytes; }));
+
+    bench_results.push_back(Measure("SearchDirectoryContent", bench_config.iterations, [&](auto &&_timed_call)
+                                    {
+        std::size_t match_count(0);
+        _timed_call([&] { match_count += fsc.SearchDirectoryContent(source_root, "FSC!", [](const stContentMatch &) { return true; }, {.worker_count = bench_config.workers}); });
+        return synthetic_tree.total_bytes; }));
+
+    if (bench_config.json_path.empty())
+    {
+        WriteJson(std::cout, bench_config, synthetic_tree, bench_results);
+    }
+    else
+    {
+        std::ofstream json_out(bench_config.json_path, std::ios::trunc);
+        WriteJson(json_out, bench_config, synthetic_tree, bench_results);
+    }
+
+    if (!bench_config.keep_tree)
+        std::filesystem::remove_all(bench_config.bench_dir);
+    else
+        std::cerr << "tree kept in " << bench_config.bench_dir << "\n";
+    return 0;
+}